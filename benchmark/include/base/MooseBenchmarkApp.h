@@ -0,0 +1,38 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MOOSEBENCHMARKAPP_H
+#define MOOSEBENCHMARKAPP_H
+
+#include "MooseApp.h"
+
+class MooseBenchmarkApp;
+
+template<>
+InputParameters validParams<MooseBenchmarkApp>();
+
+/**
+ * Application running the inputs of the performance benchmark suite, which needs the objects
+ * of the framework and of all modules.
+ */
+class MooseBenchmarkApp : public MooseApp
+{
+public:
+  MooseBenchmarkApp(const std::string & name, InputParameters parameters);
+  virtual ~MooseBenchmarkApp();
+
+  static void registerApps();
+};
+
+#endif /* MOOSEBENCHMARKAPP_H */
@@ -0,0 +1,222 @@
+# Frictionless penalty contact between two blocks, refined with Mesh/uniform_refine
+[Mesh]
+  file = ../../modules/combined/tests/mechanical_contact_constraint/blocks_2d/blocks_2d.e
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./penetration]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./inc_slip_x]
+  [../]
+  [./inc_slip_y]
+  [../]
+  [./accum_slip_x]
+  [../]
+  [./accum_slip_y]
+  [../]
+[]
+
+[Functions]
+  [./vertical_movement]
+    type = ParsedFunction
+    value = -t
+  [../]
+[]
+
+[SolidMechanics]
+  [./solid]
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+[]
+
+[AuxKernels]
+  [./zeroslip_x]
+    type = ConstantAux
+    variable = inc_slip_x
+    boundary = 3
+    execute_on = timestep_begin
+    value = 0.0
+  [../]
+  [./zeroslip_y]
+    type = ConstantAux
+    variable = inc_slip_y
+    boundary = 3
+    execute_on = timestep_begin
+    value = 0.0
+  [../]
+  [./accum_slip_x]
+    type = AccumulateAux
+    variable = accum_slip_x
+    accumulate_from_variable = inc_slip_x
+    execute_on = timestep
+  [../]
+  [./accum_slip_y]
+    type = AccumulateAux
+    variable = accum_slip_y
+    accumulate_from_variable = inc_slip_y
+    execute_on = timestep
+  [../]
+  [./penetration]
+    type = PenetrationAux
+    variable = penetration
+    boundary = 3
+    paired_boundary = 2
+  [../]
+[]
+
+[BCs]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 1
+    value = 0.0
+  [../]
+  [./left_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0.0
+  [../]
+  [./right_x]
+    type = PresetBC
+    variable = disp_x
+    boundary = 4
+    #Initial gap is 0.01
+    value = -0.02
+  [../]
+  [./right_y]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = 4
+    function = vertical_movement
+  [../]
+[]
+
+[Postprocessors]
+  [./max_penetration]
+    type = NodalExtremeValue
+    variable = penetration
+    boundary = 3
+  [../]
+  # Per-phase timings read by run_benchmarks
+  [./time_residual]
+    type = PerformanceData
+    event = compute_residual()
+    column = total_time_with_sub
+  [../]
+  [./time_jacobian]
+    type = PerformanceData
+    event = compute_jacobian()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_elemental]
+    type = PerformanceData
+    event = update_aux_vars_elemental()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_nodal]
+    type = PerformanceData
+    event = update_aux_vars_nodal()
+    column = total_time_with_sub
+  [../]
+  [./time_user_objects]
+    type = PerformanceData
+    event = compute_user_objects()
+    column = total_time_with_sub
+  [../]
+  [./time_output]
+    type = PerformanceData
+    event = outputStep()
+    column = total_time_with_sub
+  [../]
+  [./time_multiapps]
+    type = PerformanceData
+    event = execMultiApps()
+    column = total_time_with_sub
+  [../]
+  [./time_transfers]
+    type = PerformanceData
+    event = execTransfers()
+    column = total_time_with_sub
+  [../]
+  [./time_solve]
+    type = PerformanceData
+    event = solve()
+    column = total_time_with_sub
+  [../]
+[]
+
+[Materials]
+  [./left]
+    type = LinearIsotropicMaterial
+    block = 1
+    disp_y = disp_y
+    disp_x = disp_x
+    poissons_ratio = 0.3
+    youngs_modulus = 1e7
+  [../]
+  [./right]
+    type = LinearIsotropicMaterial
+    block = 2
+    disp_y = disp_y
+    disp_x = disp_x
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = 'none'
+
+  l_max_its = 100
+  nl_max_its = 1000
+  dt = 0.01
+  end_time = 0.10
+  num_steps = 1000
+  l_tol = 1e-6
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-8
+  dtmin = 0.01
+
+  [./Predictor]
+    type = SimplePredictor
+    scale = 1.0
+  [../]
+[]
+
+[Outputs]
+  file_base = contact_out
+  exodus = true
+  csv = true
+[]
+
+[Contact]
+  [./leftright]
+    system = Constraint
+    master = 2
+    slave = 3
+    disp_x = disp_x
+    disp_y = disp_y
+    model = frictionless
+    formulation = penalty
+    penalty = 1e+7
+  [../]
+[]
@@ -0,0 +1,145 @@
+# Transient diffusion with a body force on a 3D box
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+  elem_type = HEX8
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./grad_u_x]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./forcing]
+  [../]
+[]
+
+[Functions]
+  [./forcing_func]
+    type = ParsedFunction
+    value = 'x*y*z*(1+t)'
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    function = forcing_func
+  [../]
+[]
+
+[AuxKernels]
+  [./grad_u_x]
+    type = VariableGradientComponent
+    variable = grad_u_x
+    gradient_variable = u
+    component = x
+  [../]
+  [./forcing]
+    type = FunctionAux
+    variable = forcing
+    function = forcing_func
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  # Per-phase timings read by run_benchmarks
+  [./time_residual]
+    type = PerformanceData
+    event = compute_residual()
+    column = total_time_with_sub
+  [../]
+  [./time_jacobian]
+    type = PerformanceData
+    event = compute_jacobian()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_elemental]
+    type = PerformanceData
+    event = update_aux_vars_elemental()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_nodal]
+    type = PerformanceData
+    event = update_aux_vars_nodal()
+    column = total_time_with_sub
+  [../]
+  [./time_user_objects]
+    type = PerformanceData
+    event = compute_user_objects()
+    column = total_time_with_sub
+  [../]
+  [./time_output]
+    type = PerformanceData
+    event = outputStep()
+    column = total_time_with_sub
+  [../]
+  [./time_multiapps]
+    type = PerformanceData
+    event = execMultiApps()
+    column = total_time_with_sub
+  [../]
+  [./time_transfers]
+    type = PerformanceData
+    event = execTransfers()
+    column = total_time_with_sub
+  [../]
+  [./time_solve]
+    type = PerformanceData
+    event = solve()
+    column = total_time_with_sub
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  file_base = diffusion_out
+  exodus = true
+  csv = true
+[]
@@ -0,0 +1,102 @@
+# Transient reaction-diffusion with second order elements, dominated by the kernel loops.
+# The "kernels_qp_loops" benchmark runs it with GlobalParams/use_weak_form=false to measure
+# the weak form contraction against the computeQpResidual()/computeQpJacobian() loops.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 12
+  ny = 12
+  nz = 12
+  elem_type = HEX27
+[]
+
+[GlobalParams]
+  use_weak_form = true
+[]
+
+[Variables]
+  [./u]
+    order = SECOND
+  [../]
+[]
+
+[Functions]
+  [./forcing_func]
+    type = ParsedFunction
+    value = 'x*y*z*(1+t)'
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    function = forcing_func
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  # Per-phase timings read by run_benchmarks
+  [./time_residual]
+    type = PerformanceData
+    event = compute_residual()
+    column = total_time_with_sub
+  [../]
+  [./time_jacobian]
+    type = PerformanceData
+    event = compute_jacobian()
+    column = total_time_with_sub
+  [../]
+  [./time_solve]
+    type = PerformanceData
+    event = solve()
+    column = total_time_with_sub
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  file_base = kernels_out
+  csv = true
+[]
@@ -0,0 +1,130 @@
+# Diffusion driving nine sub-app solves through mesh function transfers, refined with Mesh/uniform_refine
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 40
+  # The MultiAppMeshFunctionTransfer doesn't work with ParallelMesh (see #2145)
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  # Per-phase timings read by run_benchmarks
+  [./time_residual]
+    type = PerformanceData
+    event = compute_residual()
+    column = total_time_with_sub
+  [../]
+  [./time_jacobian]
+    type = PerformanceData
+    event = compute_jacobian()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_elemental]
+    type = PerformanceData
+    event = update_aux_vars_elemental()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_nodal]
+    type = PerformanceData
+    event = update_aux_vars_nodal()
+    column = total_time_with_sub
+  [../]
+  [./time_user_objects]
+    type = PerformanceData
+    event = compute_user_objects()
+    column = total_time_with_sub
+  [../]
+  [./time_output]
+    type = PerformanceData
+    event = outputStep()
+    column = total_time_with_sub
+  [../]
+  [./time_multiapps]
+    type = PerformanceData
+    event = execMultiApps()
+    column = total_time_with_sub
+  [../]
+  [./time_transfers]
+    type = PerformanceData
+    event = execTransfers()
+    column = total_time_with_sub
+  [../]
+  [./time_solve]
+    type = PerformanceData
+    event = solve()
+    column = total_time_with_sub
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1
+
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  file_base = multiapp_out
+  exodus = true
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '0.1 0.1 0 0.4 0.1 0 0.7 0.1 0 0.1 0.4 0 0.4 0.4 0 0.7 0.4 0 0.1 0.7 0 0.4 0.7 0 0.7 0.7 0'
+    type = TransientMultiApp
+    app_type = MooseBenchmarkApp
+    input_files = multiapp_sub.i
+    execute_on = timestep
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    source_variable = u
+    direction = to_multiapp
+    variable = transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+  [../]
+
+  [./elemental_to_sub]
+    source_variable = u
+    direction = to_multiapp
+    variable = elemental_transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+  [../]
+[]
@@ -0,0 +1,151 @@
+# Grain growth of a Voronoi polycrystal with periodic boundaries, refined with Mesh/uniform_refine
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 40
+  nz = 0
+  xmin = 0
+  xmax = 1000
+  ymin = 0
+  ymax = 1000
+  zmin = 0
+  zmax = 0
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 8
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalVoronoiIC]
+      grain_num = 12
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./bnds]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./PolycrystalKernel]
+  [../]
+[]
+
+[AuxKernels]
+  [./BndsCalc]
+    type = BndsCalcAux
+    variable = bnds
+    execute_on = timestep
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./All]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./Copper]
+    type = GBEvolution
+    block = 0
+    T = 500 # K
+    wGB = 60 # nm
+    GBmob0 = 2.5e-6 #m^4/(Js) from Schoenfelder 1997
+    Q = 0.23 #Migration energy in eV
+    GBenergy = 0.708 #GB energy in J/m^2
+  [../]
+[]
+
+[Postprocessors]
+  [./ngrains]
+    type = NodalFloodCount
+    variable = bnds
+    threshold = 0.7
+  [../]
+  # Per-phase timings read by run_benchmarks
+  [./time_residual]
+    type = PerformanceData
+    event = compute_residual()
+    column = total_time_with_sub
+  [../]
+  [./time_jacobian]
+    type = PerformanceData
+    event = compute_jacobian()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_elemental]
+    type = PerformanceData
+    event = update_aux_vars_elemental()
+    column = total_time_with_sub
+  [../]
+  [./time_aux_nodal]
+    type = PerformanceData
+    event = update_aux_vars_nodal()
+    column = total_time_with_sub
+  [../]
+  [./time_user_objects]
+    type = PerformanceData
+    event = compute_user_objects()
+    column = total_time_with_sub
+  [../]
+  [./time_output]
+    type = PerformanceData
+    event = outputStep()
+    column = total_time_with_sub
+  [../]
+  [./time_multiapps]
+    type = PerformanceData
+    event = execMultiApps()
+    column = total_time_with_sub
+  [../]
+  [./time_transfers]
+    type = PerformanceData
+    event = execTransfers()
+    column = total_time_with_sub
+  [../]
+  [./time_solve]
+    type = PerformanceData
+    event = solve()
+    column = total_time_with_sub
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = 'bdf2'
+
+  solve_type = 'PJFNK'
+
+
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'hypre boomeramg 31'
+  l_tol = 1.0e-4
+  l_max_its = 30
+  nl_max_its = 20
+  nl_rel_tol = 1.0e-9
+  start_time = 0.0
+  num_steps = 4
+  dt = 80.0
+[]
+
+[Outputs]
+  file_base = polycrystal_out
+  exodus = true
+  csv = true
+[]
@@ -20,6 +20,7 @@
 #include "MooseVariable.h"
 #include "MooseVariableScalar.h"
 #include "MooseTypes.h"
+#include "MemoryUsage.h"
 // libMesh
 #include "libmesh/dof_map.h"
 #include "libmesh/dense_matrix.h"
@@ -39,7 +40,7 @@ class SystemBase;
  * Keeps track of stuff related to assembling
  *
  */
-class Assembly
+class Assembly : public MemoryUsageReporter
 {
 public:
   Assembly(SystemBase & sys, CouplingMatrix * & cm, THREAD_ID tid);
@@ -359,6 +360,14 @@ public:
   void addJacobian(SparseMatrix<Number> & jacobian);
   void addJacobianBlock(SparseMatrix<Number> & jacobian, unsigned int ivar, unsigned int jvar, const DofMap & dof_map, std::vector<dof_id_type> & dof_indices);
   void addJacobianNeighbor(SparseMatrix<Number> & jacobian);
+
+  /**
+   * Multiplies the element Jacobian blocks by the entries of v on the element and adds the
+   * products to y instead of adding the blocks to a matrix
+   * @param v Vector to multiply, must contain the ghosted entries
+   * @param y The products are added in here
+   */
+  void addJacobianAction(const NumericVector<Number> & v, NumericVector<Number> & y);
   void addJacobianNeighbor(SparseMatrix<Number> & jacobian, unsigned int ivar, unsigned int jvar, const DofMap & dof_map, std::vector<dof_id_type> & dof_indices, std::vector<dof_id_type> & neighbor_dof_indices);
   void addJacobianScalar(SparseMatrix<Number> & jacobian);
   void addJacobianOffDiagScalar(SparseMatrix<Number> & jacobian, unsigned int ivar);
@@ -419,6 +428,11 @@ public:
    */
   void invalidateCache();
 
+  /**
+   * Reports the shape function values (including the per element FE cache) and the cached residual and Jacobian entries as "FE caches"
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
   std::map<FEType, bool> _need_second_derivative;
 
 protected:
@@ -443,6 +457,7 @@ protected:
   void setResidualBlock(NumericVector<Number> & residual, DenseVector<Number> & res_block, std::vector<unsigned int> & dof_indices, Real scaling_factor);
 
   void addJacobianBlock(SparseMatrix<Number> & jacobian, DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
+  void addJacobianBlockAction(const NumericVector<Number> & v, NumericVector<Number> & y, DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
 
   SystemBase & _sys;
   /// Reference to coupling matrix
@@ -584,6 +599,9 @@ protected:
 
   /// auxiliary matrix for scaling jacobians (optimization to avoid expensive construction/destruction)
   DenseMatrix<Number> _tmp_Ke;
+  /// Element entries of the vector multiplied by a Jacobian block and of the product
+  DenseVector<Number> _tmp_v_action;
+  DenseVector<Number> _tmp_y_action;
 
   // Shape function values, gradients. second derivatives
   VariablePhiValue _phi;
@@ -631,6 +649,9 @@ protected:
   /// Cached shape function values stored by element
   std::map<unsigned int, ElementFEShapeData * > _element_fe_shape_data_cache;
 
+  /// Bytes held by the shape function values of one FE type
+  static std::size_t shapeDataBytes(const FEShapeData & data);
+
   /// Whether or not fe cache should be built at all
   bool _should_use_fe_cache;
 
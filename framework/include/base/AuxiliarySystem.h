@@ -84,6 +84,11 @@ public:
   virtual void serializeSolution();
   virtual NumericVector<Number> & serializedSolution();
 
+  /**
+   * Adds the serialized solution to the vectors of the system
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
   // This is an empty function since the Aux system doesn't have a matrix!
   virtual void augmentSparsity(SparsityPattern::Graph & /*sparsity*/,
                                std::vector<unsigned int> & /*n_nz*/,
@@ -22,6 +22,8 @@
 
 class FEProblem;
 class NonlinearSystem;
+class Coupleable;
+class MooseVariable;
 
 
 class ComputeFullJacobianThread : public ComputeJacobianThread
@@ -42,6 +44,12 @@ protected:
   virtual void computeJacobian();
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian();
+
+  /**
+   * Whether the off-diagonal block (ivar, jvar) of an object has to be computed, i.e. the coupling
+   * is not derived from the objects or the object couples jvar
+   */
+  bool isCoupled(const Coupleable & object, const MooseVariable & ivar, const MooseVariable & jvar) const;
 };
 
 #endif //COMPUTEFULLJACOBIANTHREAD_H
@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+class FEProblem;
+class NonlinearSystem;
+
+/**
+ * Computes the element Jacobians like ComputeFullJacobianThread but multiplies them by a vector
+ * right away instead of assembling them into a matrix.
+ */
+class ComputeJacobianActionThread : public ComputeFullJacobianThread
+{
+public:
+  /**
+   * @param v The vector to multiply, must contain the ghosted entries
+   * @param y The product is added in here
+   */
+  ComputeJacobianActionThread(FEProblem & fe_problem, NonlinearSystem & sys, const NumericVector<Number> & v, NumericVector<Number> & y);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  virtual void postElement(const Elem * elem);
+
+  void join(const ComputeJacobianActionThread & /*y*/)
+  {}
+
+protected:
+  const NumericVector<Number> & _v;
+  NumericVector<Number> & _y;
+};
+
+#endif //COMPUTEJACOBIANACTIONTHREAD_H
@@ -19,6 +19,8 @@
 // libMesh includes
 #include "libmesh/elem_range.h"
 
+#include <sys/time.h>
+
 class FEProblem;
 class NonlinearSystem;
 
@@ -36,7 +38,7 @@ public:
   virtual void onElement(const Elem *elem);
   virtual void onBoundary(const Elem *elem, unsigned int side, BoundaryID bnd_id);
   virtual void onInternalSide(const Elem *elem, unsigned int side);
-  virtual void postElement(const Elem * /*elem*/);
+  virtual void postElement(const Elem * elem);
   virtual void post();
 
   void join(const ComputeJacobianThread & /*y*/);
@@ -47,6 +49,11 @@ protected:
 
   unsigned int _num_cached;
 
+  /// Whether the time spent on each element is measured
+  bool _measure_elem_cost;
+  /// Start of the work on the current element
+  timeval _elem_start;
+
   virtual void computeJacobian();
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian();
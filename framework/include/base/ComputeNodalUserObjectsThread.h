@@ -22,11 +22,12 @@
 
 class Problem;
 class SubProblem;
+class FEProblem;
 
 class ComputeNodalUserObjectsThread
 {
 public:
-  ComputeNodalUserObjectsThread(SubProblem & problem, std::vector<UserObjectWarehouse> & user_objects, UserObjectWarehouse::GROUP group);
+  ComputeNodalUserObjectsThread(FEProblem & problem, std::vector<UserObjectWarehouse> & user_objects, UserObjectWarehouse::GROUP group);
   // Splitting Constructor
   ComputeNodalUserObjectsThread(ComputeNodalUserObjectsThread & x, Threads::split split);
 
@@ -37,6 +38,7 @@ public:
   void join(const ComputeNodalUserObjectsThread & /*y*/);
 
 protected:
+  FEProblem & _fe_problem;
   SubProblem & _sub_problem;
   THREAD_ID _tid;
 
@@ -51,6 +51,13 @@ public:
    */
   const std::vector<MooseVariable *> & getCoupledMooseVars() const { return _coupled_moose_vars; }
 
+  /**
+   * Whether a variable is coupled into this object through any of its coupled parameters
+   * @param var The variable to check
+   * @return True if the variable is coupled
+   */
+  bool isCoupledMooseVar(const MooseVariable & var) const;
+
 protected:
   /**
    * Returns true if a variables has been coupled as name.
@@ -65,6 +65,12 @@ public:
   virtual void syncSolutions(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln);
   virtual void updateMesh(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln);
 
+  /**
+   * Number of mesh updates where the nodes moved less than displaced_search_update_tolerance,
+   * so the DiracKernel point locator was not rebuilt
+   */
+  unsigned int nSkippedSearchUpdates() const { return _n_skipped_search_updates; }
+
   virtual bool isTransient() const { return _mproblem.isTransient(); }
   virtual Moose::CoordinateSystemType getCoordSystem(SubdomainID sid) { return _mproblem.getCoordSystem(sid); }
 
@@ -93,6 +99,7 @@ public:
   virtual bool reinitDirac(const Elem * elem, THREAD_ID tid);
   virtual void reinitElem(const Elem * elem, THREAD_ID tid);
   virtual void reinitElemPhys(const Elem * elem, std::vector<Point> phys_points_in_elem, THREAD_ID tid);
+  virtual void reinitElemRef(const Elem * elem, const std::vector<Point> & reference_points, THREAD_ID tid);
   virtual void reinitElemFace(const Elem * elem, unsigned int side, BoundaryID bnd_id, THREAD_ID tid);
   virtual void reinitNode(const Node * node, THREAD_ID tid);
   virtual void reinitNodeFace(const Node * node, BoundaryID bnd_id, THREAD_ID tid);
@@ -137,6 +144,11 @@ public:
   virtual void updateGeomSearch(GeometricSearchData::GeometricSearchType type = GeometricSearchData::ALL);
   virtual GeometricSearchData & geomSearchData() { return _geometric_search_data; }
 
+  /**
+   * Reports the displaced mesh, systems, assembly and geometric search data
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
   virtual bool computingInitialResidual();
 
   virtual void onTimestepBegin();
@@ -192,6 +204,13 @@ protected:
 
   GeometricSearchData _geometric_search_data;
 
+  /// Node movement below which the DiracKernel point locator is not rebuilt
+  Real _search_update_tolerance;
+  /// Sum of the largest node movements of the mesh updates since the point locator was last rebuilt
+  Real _movement_since_search_update;
+  /// Number of mesh updates that reused the point locator
+  unsigned int _n_skipped_search_updates;
+
 private:
   /**
    * NOTE: This is an internal function meant for MOOSE use only!
@@ -40,6 +40,7 @@
 #include "Restartable.h"
 #include "SolverParams.h"
 #include "OutputWarehouse.h"
+#include "ObjectTimings.h"
 
 class DisplacedProblem;
 
@@ -130,6 +131,15 @@ public:
 
   bool areCoupled(unsigned int ivar, unsigned int jvar) { return (*_cm)(ivar, jvar); }
 
+  /**
+   * Extend the coupling matrix with the variables coupled into the Kernels, IntegratedBCs, DGKernels
+   * and DiracKernels of each variable once all objects are added, and only compute the off-diagonal
+   * Jacobian blocks of the objects actually coupling the two variables.
+   * @param kernel_coupling Whether to derive the coupling from the objects
+   */
+  void setKernelCoupling(bool kernel_coupling) { _kernel_coupling = kernel_coupling; }
+  bool kernelCoupling() const { return _kernel_coupling; }
+
   std::vector<std::pair<MooseVariable *, MooseVariable *> > & couplingEntries(THREAD_ID tid) { return _assembly[tid]->couplingEntries(); }
 
   /**
@@ -251,6 +261,7 @@ public:
   virtual bool reinitDirac(const Elem * elem, THREAD_ID tid);
   virtual void reinitElem(const Elem * elem, THREAD_ID tid);
   virtual void reinitElemPhys(const Elem * elem, std::vector<Point> phys_points_in_elem, THREAD_ID tid);
+  virtual void reinitElemRef(const Elem * elem, const std::vector<Point> & reference_points, THREAD_ID tid);
   virtual void reinitElemFace(const Elem * elem, unsigned int side, BoundaryID bnd_id, THREAD_ID tid);
   virtual void reinitNode(const Node * node, THREAD_ID tid);
   virtual void reinitNodeFace(const Node * node, BoundaryID bnd_id, THREAD_ID tid);
@@ -714,6 +725,41 @@ public:
 #endif //LIBMESH_ENABLE_AMR
   virtual void meshChanged();
 
+  /**
+   * Turn on/off measuring the time spent on each element in the residual and Jacobian loops
+   */
+  void measureElementCost(bool measure);
+  bool measuringElementCost() const { return _measure_elem_cost; }
+
+  /**
+   * Add time spent on an element (called from the residual and Jacobian threads)
+   */
+  void addElementCost(const Elem * elem, Real cost) { _elem_cost[elem->id()] += cost; }
+
+  /**
+   * The time spent in the individual kernels, materials, aux kernels and user objects, or NULL
+   * if it is not measured (see the object_timing parameter)
+   */
+  ObjectTimings * objectTimings() { return _object_timings; }
+
+  /**
+   * Print the measured object timings sorted by decreasing time (if they are measured)
+   */
+  void outputObjectTimings();
+
+  /**
+   * Reports the memory used by the mesh, the systems, the stateful material properties, the FE caches
+   * and the geometric search data (including the ones of the displaced problem)
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
+  /**
+   * Repartition the mesh using the measured element costs as weights, migrating the solution
+   * and the stateful material properties to the new owners.  The imbalance (maximum over average
+   * processor cost) before and after is reported.
+   */
+  virtual void repartitionMesh();
+
   /**
    * Register an object that derives from MeshChangedInterface
    * to be notified when the mesh changes.
@@ -734,6 +780,13 @@ public:
    */
   void setConstJacobian(bool state) { _const_jacobian = state; }
 
+  /**
+   * The number of Jacobians assembled and the number of Jacobian evaluations that reused the
+   * previous Jacobian instead (constant or lagged Jacobians)
+   */
+  unsigned int nJacobianEvaluations() const { return _n_jacobians_computed; }
+  unsigned int nJacobiansReused() const { return _n_jacobians_reused; }
+
   void registerRandomInterface(RandomInterface & random_interface, const std::string & name);
 
   void setKernelCoverageCheck(bool flag) { _kernel_coverage_check = flag; }
@@ -846,6 +899,19 @@ protected:
 
   Moose::CouplingType _coupling;                        ///< Type of variable coupling
   CouplingMatrix * _cm;                                 ///< Coupling matrix for variables. It is diagonal, since we do only block diagonal preconditioning.
+  bool _kernel_coupling;                                ///< Whether the off-diagonal coupling is derived from the coupled variables of the objects
+
+  /**
+   * Add the coupling entries declared by the objects of the nonlinear system to the coupling matrix
+   * and rebuild the sparsity pattern if any were added
+   */
+  void addKernelCoupling();
+
+  /**
+   * Couple ivar to the nonlinear variables in coupled_vars
+   * @return true if an entry was added to the coupling matrix
+   */
+  bool addCouplingEntries(unsigned int ivar, const std::vector<MooseVariable *> & coupled_vars);
 
   // Dimension of the subspace spanned by the vectors with a given prefix
   std::map<std::string,unsigned int> _subspace_dim;
@@ -917,6 +983,21 @@ protected:
   /// Verify that there are no element type/coordinate type conflicts
   void checkCoordinateSystems();
 
+  /**
+   * Send the stateful material properties of the elements that changed owner during
+   * repartitioning to their new processors
+   * @param old_owners The processor ids of the active elements before repartitioning
+   */
+  void migrateStatefulProperties(const std::vector<processor_id_type> & old_owners);
+
+  /**
+   * Update everything that depends on the mesh
+   * @param project_stateful Whether the stateful material properties of the elements libMesh flags as
+   * just refined or coarsened are projected.  Repartitioning passes false: adaptMesh() already
+   * projected them, and the parents of migrated children have no stateful data on their new owner.
+   */
+  void meshChangedHelper(bool project_stateful);
+
   /**
    * Call when it is possible that the needs for ghosted elements has changed.
    */
@@ -957,6 +1038,24 @@ protected:
   /// Indicates if the Jacobian was computed
   bool _has_jacobian;
 
+  /**
+   * Whether the Jacobian evaluation requested by the nonlinear solver can reuse the previous Jacobian
+   * according to the lagging options in the SolverParams
+   */
+  virtual bool reuseJacobian();
+
+  /// Number of assembled and reused Jacobians
+  unsigned int _n_jacobians_computed;
+  unsigned int _n_jacobians_reused;
+  /// Time step, Newton iteration and time derivative shift the current Jacobian is used since
+  int _jacobian_t_step;
+  unsigned int _jacobian_nl_it;
+  Real _jacobian_du_dot_du;
+  /// Linear iterations of the solve in progress at the last Jacobian evaluation
+  unsigned int _jacobian_l_its;
+  /// Iterations of the last linear solve
+  unsigned int _last_l_its;
+
   SolverParams _solver_params;
 
   /// Determines whether a check to verify an active kernel on every subdomain
@@ -968,6 +1067,14 @@ protected:
   /// Preconditioner description
   std::string _pc_description;
 
+  /// Whether the time spent on each element is measured
+  bool _measure_elem_cost;
+  /// Accumulated time spent on each local element, indexed by element id
+  std::vector<Real> _elem_cost;
+
+  /// Time spent in the individual objects, NULL if not measured
+  ObjectTimings * _object_timings;
+
 public:
   /// number of instances of FEProblem (to distinguish Systems when coupling problems together)
   static unsigned int _n;
@@ -21,6 +21,7 @@
 
 // Forward declarations
 class MeshChangedInterface;
+class FEProblem;
 
 template<>
 InputParameters validParams<MeshChangedInterface>();
@@ -35,6 +35,7 @@
 class Executioner;
 class MooseApp;
 class RecoverBaseAction;
+class MultiAppInputCache;
 
 template<>
 InputParameters validParams<MooseApp>();
@@ -319,6 +320,17 @@ public:
    */
   SystemInfo * getSystemInfo() { return _sys_info.get(); }
 
+  /**
+   * Share parsed input files and meshes read from files with sibling apps
+   * @see MultiApp
+   */
+  void setInputCache(MooseSharedPointer<MultiAppInputCache> cache) { _input_cache = cache; }
+
+  /**
+   * The cache of parsed input files and meshes shared with sibling apps (NULL if there is none)
+   */
+  MultiAppInputCache * inputCache() { return _input_cache.get(); }
+
 protected:
 
   MooseApp(const std::string & name, InputParameters parameters);
@@ -421,6 +433,9 @@ protected:
   /// Legacy Uo Initialization flag
   bool _legacy_uo_initialization_default;
 
+  /// Parsed input files and meshes shared with sibling apps
+  MooseSharedPointer<MultiAppInputCache> _input_cache;
+
 private:
 
   ///@{
@@ -221,6 +221,14 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Applies the Jacobian at the current solution to a vector element by element, without assembling it.
+   * Used as the operator of the MATRIX_FREE solve type.
+   * @param v The vector to multiply
+   * @param y The product is formed in here
+   */
+  void computeJacobianAction(const NumericVector<Number> & v, NumericVector<Number> & y);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller preconditioning matrices.
    *
@@ -269,6 +277,11 @@ public:
   virtual NumericVector<Number> & residualCopy();
   virtual NumericVector<Number> & residualGhosted();
 
+  /**
+   * Adds the serialized solution and residual copies to the vectors and reports the system matrix as "Sparse matrices"
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
   virtual void augmentSparsity(SparsityPattern::Graph & sparsity,
                                std::vector<unsigned int> & n_nz,
                                std::vector<unsigned int> & n_oz);
@@ -285,6 +298,12 @@ public:
    */
   void useFiniteDifferencedPreconditioner(bool use = true) { _use_finite_differenced_preconditioner = use; }
 
+  /**
+   * Installs a shell matrix applying the Jacobian element by element as the operator of the
+   * nonlinear solver, keeping the assembled matrix for the preconditioner (MATRIX_FREE solve type)
+   */
+  void setupMatrixFreeJacobian();
+
   /**
    * If called with a single string, it is used as the name of a the top-level decomposition split.
    * If the array is empty, no decomposition is used.
@@ -342,6 +361,11 @@ public:
    */
   unsigned int nLinearIterations() { return _n_linear_iters; }
 
+  /**
+   * Return the number of linear iterations done so far in the nonlinear solve in progress
+   */
+  unsigned int nCurrentLinearIterations();
+
   /**
    * Return the total number of residual evaluations done so far in this calculation
    */
@@ -509,7 +533,11 @@ protected:
   bool _use_finite_differenced_preconditioner;
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
+  /// Shell matrix applying the Jacobian element by element (MATRIX_FREE solve type)
+  Mat _mf_jacobian;
 #endif
+  /// Rows of the Jacobian replaced by the nodal boundary conditions in the last Jacobian evaluation
+  std::vector<numeric_index_type> _nodal_bc_jacobian_rows;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
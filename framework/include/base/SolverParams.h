@@ -24,6 +24,15 @@ public:
 
   Moose::SolveType _type;
   Moose::LineSearchType _line_search;
+
+  /// Rebuild the Jacobian every this many Newton iterations
+  unsigned int _lag_jacobian;
+  /// Rebuild the Jacobian at the first Newton iteration of every this many time steps
+  unsigned int _lag_jacobian_steps;
+  /// Rebuild a lagged Jacobian as soon as a linear solve takes more iterations than this (0 disables it)
+  unsigned int _lag_jacobian_max_linear_its;
+  /// Rebuild the preconditioner every this many Newton iterations (-1 never, passed to PETSc)
+  int _lag_preconditioner;
 };
 
 #endif /* SOLVERPARAMS_H_ */
@@ -21,6 +21,7 @@
 #include "Assembly.h"
 #include "GeometricSearchData.h"
 #include "RestartableData.h"
+#include "MemoryUsage.h"
 
 // libMesh include
 #include "libmesh/equation_systems.h"
@@ -40,7 +41,9 @@ InputParameters validParams<SubProblem>();
  * Generic class for solving transient nonlinear problems
  *
  */
-class SubProblem : public Problem
+class SubProblem :
+  public Problem,
+  public MemoryUsageReporter
 {
 public:
   SubProblem(const std::string & name, InputParameters parameters);
@@ -137,6 +140,10 @@ public:
 
   virtual void reinitElem(const Elem * elem, THREAD_ID tid) = 0;
   virtual void reinitElemPhys(const Elem * elem, std::vector<Point> phys_points_in_elem, THREAD_ID tid) = 0;
+  /**
+   * Like reinitElemPhys() but with points already mapped to the reference element (skips the inverse map)
+   */
+  virtual void reinitElemRef(const Elem * elem, const std::vector<Point> & reference_points, THREAD_ID tid) = 0;
   virtual void reinitElemFace(const Elem * elem, unsigned int side, BoundaryID bnd_id, THREAD_ID tid) = 0;
   virtual void reinitNode(const Node * node, THREAD_ID tid) = 0;
   virtual void reinitNodeFace(const Node * node, BoundaryID bnd_id, THREAD_ID tid) = 0;
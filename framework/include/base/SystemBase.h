@@ -24,6 +24,7 @@
 #include "SubProblem.h"
 #include "MooseVariableScalar.h"
 #include "MooseException.h"
+#include "MemoryUsage.h"
 
 // libMesh
 #include "libmesh/equation_systems.h"
@@ -56,7 +57,9 @@ void extraSparsity(SparsityPattern::Graph & sparsity,
  * Base class for a system (of equations)
  *
  */
-class SystemBase : public libMesh::ParallelObject
+class SystemBase :
+  public libMesh::ParallelObject,
+  public MemoryUsageReporter
 {
 public:
   SystemBase(SubProblem & subproblem, const std::string & name);
@@ -77,6 +80,11 @@ public:
    */
   virtual System & system() = 0;
 
+  /**
+   * Reports the dof map as "DOF maps" and the vectors of the system as "Solution and aux vectors"
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
   /**
    * Initialize the system
    */
@@ -26,13 +26,23 @@ class UpdateDisplacedMeshThread
 public:
   UpdateDisplacedMeshThread(DisplacedProblem & problem);
 
-  void operator() (const SemiLocalNodeRange & range) const;
+  // Splitting Constructor
+  UpdateDisplacedMeshThread(UpdateDisplacedMeshThread & x, Threads::split split);
+
+  void operator() (const SemiLocalNodeRange & range);
+
+  void join(const UpdateDisplacedMeshThread & y);
+
+  /// The largest distance a node moved during this update
+  Real maxNodeMovement() const { return _max_node_movement; }
 
 protected:
   DisplacedProblem & _problem;
   MooseMesh & _ref_mesh;
   const NumericVector<Number> & _nl_soln;
   const NumericVector<Number> & _aux_soln;
+
+  Real _max_node_movement;
 };
 
 #endif /* UPDATEDISPLACEDMESHTHREAD_H */
@@ -77,6 +77,12 @@ public:
    */
   void activeIntegrated(BoundaryID boundary_id, std::vector<IntegratedBC *> & active_integrated) const;
 
+  /**
+   * Get the integrated boundary conditions on all boundaries, whether they are active or not
+   * @param integrated A vector to populate with the integrated bcs
+   */
+  void allIntegrated(std::vector<IntegratedBC *> & integrated) const;
+
   /**
    * Get active nodal boundary conditions
    * @param boundary_id Boundary ID
@@ -198,7 +198,7 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const CompressedAdjacency & _node_to_elem_map;
 
   /**
    * Whether or not the slave's residual should be overwritten.
@@ -25,6 +25,7 @@
 // System includes
 #include <string>
 #include <fstream>
+#include <deque>
 
 // Forward Declarations
 class Transient;
@@ -216,6 +217,28 @@ protected:
    */
   virtual void solveStep(Real input_dt = -1.0);
 
+  /**
+   * Gather the relaxed dofs and reset the relaxation history at the beginning of a time step
+   */
+  void initPicardRelaxation();
+
+  /**
+   * Replace the freshly transferred values of the relaxed quantities by their Aitken or Anderson update
+   */
+  void relaxPicardIterate();
+
+  /**
+   * Read or write the values of the relaxed quantities: the locally owned dofs of the relaxed
+   * variables followed by the relaxed postprocessors
+   */
+  void getPicardValues(std::vector<Real> & values);
+  void setPicardValues(const std::vector<Real> & values);
+
+  /**
+   * Inner product of two vectors of relaxed values, summed over all processors
+   */
+  Real picardDot(const std::vector<Real> & a, const std::vector<Real> & b);
+
   FEProblem & _problem;
 
   MooseEnum _time_scheme;
@@ -280,6 +303,30 @@ protected:
   Real _picard_rel_tol;
   Real _picard_abs_tol;
 
+  /// Acceleration applied to the transferred quantities between Picard iterations
+  MooseEnum _picard_relaxation;
+  /// Initial Aitken factor or Anderson mixing parameter
+  Real _picard_relaxation_factor;
+  /// Number of previous iterates used by Anderson acceleration
+  unsigned int _picard_anderson_depth;
+  /// Auxiliary variables and postprocessors filled by transfers that are relaxed
+  std::vector<std::string> _picard_relaxed_vars;
+  std::vector<PostprocessorName> _picard_relaxed_pps;
+  /// Locally owned dofs of the relaxed variables
+  std::vector<dof_id_type> _picard_relaxed_dofs;
+  /// The values the last Picard iteration used
+  std::vector<Real> _picard_x;
+  /// Previous iterates and their residuals (oldest first)
+  std::deque<std::vector<Real> > _picard_x_history;
+  std::deque<std::vector<Real> > _picard_r_history;
+  /// Current Aitken factor
+  Real _picard_aitken_factor;
+
+  /// Repartition the mesh with the measured element costs every this many steps (0 = never)
+  unsigned int _repartition_interval;
+  /// Repartition the mesh with the measured element costs whenever adaptivity changed it
+  bool _repartition_after_adaptivity;
+
   ///should detailed diagnostic output be printed
   bool _verbose;
 
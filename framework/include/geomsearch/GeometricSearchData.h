@@ -16,6 +16,7 @@
 #define GEOMETRICSEARCHDATA_H
 
 #include "MooseTypes.h"
+#include "MemoryUsage.h"
 
 //libmesh includes
 
@@ -27,7 +28,7 @@ class SubProblem;
 class PenetrationLocator;
 class NearestNodeLocator;
 
-class GeometricSearchData
+class GeometricSearchData : public MemoryUsageReporter
 {
 public:
   /// Used to select groups of geometric search objects to update
@@ -78,6 +79,11 @@ public:
    */
   Real maxPatchPercentage();
 
+  /**
+   * Reports the nearest node patches and the penetration info of all the locators as "Geometric search"
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
 //protected:
   SubProblem & _subproblem;
   MooseMesh & _mesh;
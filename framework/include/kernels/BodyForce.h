@@ -33,6 +33,9 @@ public:
 protected:
   virtual Real computeQpResidual();
 
+  virtual bool hasWeakForm();
+  virtual void computeWeakFormResidual();
+
   Real _value;
   Function & _function;
 };
@@ -32,6 +32,10 @@ public:
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
+
+  virtual bool hasWeakForm();
+  virtual void computeWeakFormResidual();
+  virtual void computeWeakFormJacobian();
 };
 
 
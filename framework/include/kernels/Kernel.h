@@ -49,6 +49,61 @@ protected:
   /// This callback is used for Kernels that need to perturb residual calculations
   virtual void precalculateResidual();
 
+  /**
+   * Terms of the weak form a Kernel can provide as coefficients at the quadrature points
+   * instead of implementing computeQpResidual() and computeQpJacobian()
+   */
+  enum WeakFormTerm
+  {
+    /// Residual _value_coef[qp] * test
+    WF_VALUE = 0x1,
+    /// Residual _flux_coef[qp] * grad_test
+    WF_FLUX = 0x2,
+    /// Jacobian _phi_test_coef[qp] * phi * test
+    WF_PHI_TEST = 0x4,
+    /// Jacobian (_grad_phi_test_coef[qp] * grad_phi) * test
+    WF_GRAD_PHI_TEST = 0x8,
+    /// Jacobian phi * (_phi_grad_test_coef[qp] * grad_test)
+    WF_PHI_GRAD_TEST = 0x10,
+    /// Jacobian _grad_phi_grad_test_coef[qp] * grad_phi * grad_test
+    WF_GRAD_PHI_GRAD_TEST = 0x20
+  };
+
+  /**
+   * Whether this Kernel computes its residual and diagonal Jacobian from the coefficients filled in
+   * computeWeakFormResidual() and computeWeakFormJacobian().  The coefficients are contracted with
+   * the test and shape functions over all quadrature points at once, without a virtual call per
+   * (i, j, qp).  Kernels overriding this usually check their exact type, so that derived classes
+   * overriding computeQpResidual() keep working.
+   */
+  virtual bool hasWeakForm();
+
+  /// Fill the coefficients of the residual terms in _weak_form_terms at all quadrature points
+  virtual void computeWeakFormResidual();
+
+  /// Fill the coefficients of the Jacobian terms in _weak_form_terms at all quadrature points
+  virtual void computeWeakFormJacobian();
+
+  /// Whether the weak form is used when the Kernel provides one
+  bool _use_weak_form;
+
+  /// The WeakFormTerm flags of the terms provided by this Kernel
+  unsigned int _weak_form_terms;
+
+  /// Weak form coefficients, one per quadrature point (see WeakFormTerm)
+  std::vector<Real> _value_coef;
+  std::vector<RealGradient> _flux_coef;
+  std::vector<Real> _phi_test_coef;
+  std::vector<RealGradient> _grad_phi_test_coef;
+  std::vector<RealGradient> _phi_grad_test_coef;
+  std::vector<Real> _grad_phi_grad_test_coef;
+
+  /// Add the weak form residual of the current element to _local_re
+  void weakFormResidual();
+
+  /// Add the weak form Jacobian of the current element to _local_ke
+  void weakFormJacobian();
+
   /// Holds the solution at current quadrature points
   VariableValue & _u;
 
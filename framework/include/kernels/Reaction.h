@@ -32,5 +32,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  virtual bool hasWeakForm();
+  virtual void computeWeakFormResidual();
+  virtual void computeWeakFormJacobian();
+
 };
 #endif //REACTION_H
@@ -34,6 +34,10 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  virtual bool hasWeakForm();
+  virtual void computeWeakFormResidual();
+  virtual void computeWeakFormJacobian();
+
   bool _lumping;
 };
 
@@ -221,7 +221,16 @@ private:
    */
   void registerPropName(std::string prop_name, bool is_get, Prop_State state);
 
+  /**
+   * Request single precision storage of the old and older values if prop_name is listed in single_precision_properties
+   */
+  template<typename T>
+  void registerSinglePrecision(const std::string & prop_name);
+
   bool _has_stateful_property;
+
+  /// Stateful properties whose old and older values are stored in single precision
+  std::set<std::string> _single_precision_props;
 };
 
 
@@ -266,6 +275,7 @@ MaterialProperty<T> &
 Material::declarePropertyOld(const std::string & prop_name)
 {
   registerPropName(prop_name, false, Material::OLD);
+  registerSinglePrecision<T>(prop_name);
   return _material_data.declarePropertyOld<T>(prop_name);
 }
 
@@ -274,8 +284,22 @@ MaterialProperty<T> &
 Material::declarePropertyOlder(const std::string & prop_name)
 {
   registerPropName(prop_name, false, Material::OLDER);
+  registerSinglePrecision<T>(prop_name);
   return _material_data.declarePropertyOlder<T>(prop_name);
 }
 
+template<typename T>
+void
+Material::registerSinglePrecision(const std::string & prop_name)
+{
+  if (_single_precision_props.find(prop_name) == _single_precision_props.end())
+    return;
+
+  if (SinglePrecisionTraits<T>::n_components == 0)
+    mooseError("Material '" << _name << "' can not store the property '" << prop_name << "' in single precision: its type has no SinglePrecisionTraits specialization.");
+
+  _material_data.declareSinglePrecision(prop_name);
+}
+
 
 #endif //MATERIAL_H
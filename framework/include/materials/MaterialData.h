@@ -18,6 +18,7 @@
 #include "Moose.h"
 #include "MaterialProperty.h"
 #include "MaterialPropertyStorage.h"
+#include "ParallelUniqueId.h"
 
 //libMesh
 #include "libmesh/elem.h"
@@ -25,6 +26,7 @@
 #include <vector>
 
 class Material;
+class ObjectTimings;
 
 /**
  * Proxy for accessing MaterialPropertyStorage.
@@ -73,13 +75,18 @@ public:
   template<typename T>
   MaterialProperty<T> & declarePropertyOlder(const std::string & prop_name);
 
+  /**
+   * Keep the old and older values of the stateful property named "name" in single precision
+   */
+  void declareSinglePrecision(const std::string & prop_name) { _storage.addSinglePrecisionProperty(prop_name); }
+
   //copy material properties from one element to another
   void copy(const Elem & elem_to, const Elem & elem_from, unsigned int side);
 
   // material properties for given element (and possible side)
   void swap(const Elem & elem, unsigned int side = 0);
-  // Reinit material properties for given element (and possible side)
-  void reinit(std::vector<Material *> & mats);
+  // Reinit material properties for given element (and possible side), timing each material if timings are given
+  void reinit(std::vector<Material *> & mats, ObjectTimings * timings = NULL, THREAD_ID tid = 0);
   // material properties for given element (and possible side)
   void swapBack(const Elem & elem, unsigned int side = 0);
 
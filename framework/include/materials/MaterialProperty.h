@@ -16,10 +16,12 @@
 #define MATERIALPROPERTY_H
 
 #include <vector>
+#include <algorithm>
 
 #include "MooseArray.h"
 #include "ColumnMajorMatrix.h"
 #include "MaterialPropertyIO.h"
+#include "SinglePrecisionTraits.h"
 
 #include "libmesh/libmesh_common.h"
 #include "libmesh/tensor_value.h"
@@ -27,6 +29,9 @@
 
 class PropertyValue;
 
+template <typename T>
+class SinglePrecisionProperty;
+
 /**
  * Scalar Init helper routine so that specialization isn't needed for basic scalar MaterialProperty types
  */
@@ -62,8 +67,24 @@ public:
    */
   virtual PropertyValue *init (int size) = 0;
 
+  /**
+   * Create a value of the same type holding its data in single precision (see SinglePrecisionProperty)
+   */
+  virtual PropertyValue *initSinglePrecision (int size) = 0;
+
+  /**
+   * Whether the data is held in single precision
+   */
+  virtual bool isSinglePrecision () { return false; }
+
   virtual int size () = 0;
 
+  /**
+   * Number of bytes used by the stored values (the memory held by the values themselves, e.g. by
+   * vector valued properties, is not included)
+   */
+  virtual std::size_t dataSize () = 0;
+
   /**
    * Resizes the property to the size n
    * Must be reimplemented in derived classes.
@@ -137,6 +158,8 @@ public:
    */
   virtual PropertyValue *init (int size);
 
+  virtual PropertyValue *initSinglePrecision (int size);
+
   /**
    * Resizes the property to the size n
    */
@@ -149,6 +172,8 @@ public:
 
   int size() { return _value.size(); }
 
+  virtual std::size_t dataSize() { return _value.size() * sizeof(T); }
+
   /**
    * Get element i out of the array.
    */
@@ -209,6 +234,52 @@ private:
 };
 
 
+/**
+ * Stores the values of a MaterialProperty<T> as floats, used by MaterialPropertyStorage for the old
+ * and older values of the properties listed in the single_precision_properties parameter of a
+ * Material.  The values are converted whenever they are swapped with or copied from a
+ * MaterialProperty<T>, so materials always compute in double precision.
+ *
+ * The components of T are accessed through SinglePrecisionTraits<T>.
+ */
+template <typename T>
+class SinglePrecisionProperty : public PropertyValue
+{
+public:
+  SinglePrecisionProperty(int size);
+
+  virtual std::string type ();
+  virtual PropertyValue *init (int size);
+  virtual PropertyValue *initSinglePrecision (int size);
+  virtual bool isSinglePrecision () { return true; }
+  virtual int size () { return _n_qpoints; }
+  virtual std::size_t dataSize () { return _value.size() * sizeof(float); }
+  virtual void resize (int n);
+
+  /**
+   * Exchange the values with rhs, converting them if rhs is a MaterialProperty<T>
+   */
+  virtual void swap (PropertyValue *rhs);
+
+  virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp);
+
+  /**
+   * Convert the value at a quadrature point back to T
+   */
+  void qpValue (const unsigned int qp, T & value) const;
+
+  virtual void store(std::ostream & stream);
+  virtual void load(std::istream & stream);
+
+private:
+  /// Number of stored values
+  unsigned int _n_qpoints;
+
+  /// The components of the values, n_components entries per quadrature point
+  std::vector<float> _value;
+};
+
+
 // ------------------------------------------------------------
 // Material::Property<> class inline methods
 template <typename T>
@@ -225,6 +296,13 @@ MaterialProperty<T>::init (int size)
   return _init_helper(size, this, static_cast<T *>(0));
 }
 
+template <typename T>
+inline PropertyValue *
+MaterialProperty<T>::initSinglePrecision (int size)
+{
+  return new SinglePrecisionProperty<T>(size);
+}
+
 template <typename T>
 inline void
 MaterialProperty<T>::resize (int n)
@@ -237,7 +315,10 @@ inline void
 MaterialProperty<T>::swap (PropertyValue *rhs)
 {
   mooseAssert(rhs != NULL, "Assigning NULL?");
-  _value.swap(cast_ptr<MaterialProperty<T>*>(rhs)->_value);
+  if (rhs->isSinglePrecision())
+    rhs->swap(this);
+  else
+    _value.swap(cast_ptr<MaterialProperty<T>*>(rhs)->_value);
 }
 
 template <typename T>
@@ -245,7 +326,10 @@ inline void
 MaterialProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp)
 {
   mooseAssert(rhs != NULL, "Assigning NULL?");
-  _value[to_qp] = cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
+  if (rhs->isSinglePrecision())
+    cast_ptr<const SinglePrecisionProperty<T>*>(rhs)->qpValue(from_qp, _value[to_qp]);
+  else
+    _value[to_qp] = cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
 }
 
 template<typename T>
@@ -264,6 +348,123 @@ MaterialProperty<T>::load(std::istream & stream)
     loadHelper(stream, _value[i], NULL);
 }
 
+// ------------------------------------------------------------
+// SinglePrecisionProperty<> class inline methods
+template <typename T>
+SinglePrecisionProperty<T>::SinglePrecisionProperty(int size) :
+    PropertyValue(),
+    _n_qpoints(size),
+    _value(size * SinglePrecisionTraits<T>::n_components)
+{
+}
+
+template <typename T>
+inline std::string
+SinglePrecisionProperty<T>::type ()
+{
+  return typeid(T).name();
+}
+
+template <typename T>
+inline PropertyValue *
+SinglePrecisionProperty<T>::init (int size)
+{
+  return new SinglePrecisionProperty<T>(size);
+}
+
+template <typename T>
+inline PropertyValue *
+SinglePrecisionProperty<T>::initSinglePrecision (int size)
+{
+  return new SinglePrecisionProperty<T>(size);
+}
+
+template <typename T>
+inline void
+SinglePrecisionProperty<T>::resize (int n)
+{
+  _n_qpoints = n;
+  _value.resize(n * SinglePrecisionTraits<T>::n_components);
+}
+
+template <typename T>
+inline void
+SinglePrecisionProperty<T>::swap (PropertyValue *rhs)
+{
+  mooseAssert(rhs != NULL, "Assigning NULL?");
+
+  if (rhs->isSinglePrecision())
+  {
+    SinglePrecisionProperty<T> * other = cast_ptr<SinglePrecisionProperty<T>*>(rhs);
+    std::swap(_n_qpoints, other->_n_qpoints);
+    _value.swap(other->_value);
+    return;
+  }
+
+  const unsigned int n_components = SinglePrecisionTraits<T>::n_components;
+  MooseArray<T> & values = cast_ptr<MaterialProperty<T>*>(rhs)->set();
+
+  // Convert the double values into a new buffer before overwriting them with ours
+  unsigned int n_other = values.size();
+  std::vector<float> converted(n_other * n_components);
+  for (unsigned int qp = 0; qp < n_other; ++qp)
+    for (unsigned int i = 0; i < n_components; ++i)
+      converted[qp * n_components + i] = SinglePrecisionTraits<T>::get(values[qp], i);
+
+  values.resize(_n_qpoints);
+  for (unsigned int qp = 0; qp < _n_qpoints; ++qp)
+    qpValue(qp, values[qp]);
+
+  _value.swap(converted);
+  _n_qpoints = n_other;
+}
+
+template <typename T>
+inline void
+SinglePrecisionProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp)
+{
+  mooseAssert(rhs != NULL, "Assigning NULL?");
+
+  const unsigned int n_components = SinglePrecisionTraits<T>::n_components;
+  if (rhs->isSinglePrecision())
+  {
+    const std::vector<float> & other = cast_ptr<const SinglePrecisionProperty<T>*>(rhs)->_value;
+    for (unsigned int i = 0; i < n_components; ++i)
+      _value[to_qp * n_components + i] = other[from_qp * n_components + i];
+  }
+  else
+  {
+    const T & value = (*cast_ptr<MaterialProperty<T>*>(rhs))[from_qp];
+    for (unsigned int i = 0; i < n_components; ++i)
+      _value[to_qp * n_components + i] = SinglePrecisionTraits<T>::get(value, i);
+  }
+}
+
+template <typename T>
+inline void
+SinglePrecisionProperty<T>::qpValue (const unsigned int qp, T & value) const
+{
+  const unsigned int n_components = SinglePrecisionTraits<T>::n_components;
+  for (unsigned int i = 0; i < n_components; ++i)
+    SinglePrecisionTraits<T>::set(value, i, _value[qp * n_components + i]);
+}
+
+template<typename T>
+inline void
+SinglePrecisionProperty<T>::store(std::ostream & stream)
+{
+  for (unsigned int i = 0; i < _value.size(); i++)
+    storeHelper(stream, _value[i], NULL);
+}
+
+template<typename T>
+inline void
+SinglePrecisionProperty<T>::load(std::istream & stream)
+{
+  for (unsigned int i = 0; i < _value.size(); i++)
+    loadHelper(stream, _value[i], NULL);
+}
+
 /**
  * Container for storing material properties
  */
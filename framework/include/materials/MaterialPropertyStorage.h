@@ -18,6 +18,7 @@
 #include "Moose.h"
 #include "MaterialProperty.h"
 #include "HashMap.h"
+#include "MemoryUsage.h"
 
 //libMesh
 #include "libmesh/elem.h"
@@ -25,6 +26,7 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
 
 class Material;
@@ -36,7 +38,7 @@ class QpMap;
  *
  * Thread-safe
  */
-class MaterialPropertyStorage
+class MaterialPropertyStorage : public MemoryUsageReporter
 {
 public:
   MaterialPropertyStorage();
@@ -147,6 +149,27 @@ public:
    */
   void swapBack(MaterialData & material_data, const Elem & elem, unsigned int side);
 
+  /**
+   * Serialize the stateful properties (all sides and states) of an element and release them
+   * from this storage.  Used to migrate properties when an element changes its owner.
+   * @param stream The stream to write to
+   * @param elem The element whose properties are packed
+   */
+  void packElem(std::ostream & stream, const Elem & elem);
+
+  /**
+   * Allocate and fill the stateful properties of an element from data written by packElem()
+   * @param stream The stream to read from
+   * @param material_data MaterialData object holding the declared (typed) properties
+   * @param elem The element whose properties are unpacked
+   */
+  void unpackElem(std::istream & stream, MaterialData & material_data, const Elem & elem);
+
+  /**
+   * Release the stateful properties of an element from this storage
+   */
+  void releaseElem(const Elem & elem);
+
   /**
    * @return a Boolean indicating whether stateful properties exist on this material
    */
@@ -166,11 +189,21 @@ public:
   unsigned int addPropertyOld(const std::string & prop_name);
   unsigned int addPropertyOlder(const std::string & prop_name);
 
+  /**
+   * Keep the old and older values of a stateful property in single precision
+   */
+  void addSinglePrecisionProperty(const std::string & prop_name);
+
   std::vector<unsigned int> & statefulProps() { return _stateful_prop_id_to_prop_id; }
   std::map<unsigned int, std::string> statefulPropNames() { return _prop_names; }
 
   unsigned int getPropertyId (const std::string & prop_name);
 
+  /**
+   * Reports the current, old and older property values as separate subsystems
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
 protected:
   // indexing: [element][side]->material_properties
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem;
@@ -198,10 +231,29 @@ protected:
   std::map<unsigned int, std::string> _prop_names;
   /// the vector of stateful property ids (the vector index is the map to stateful prop_id)
   std::vector<unsigned int> _stateful_prop_id_to_prop_id;
+  /// the property ids of the stateful properties with single precision old and older values
+  std::set<unsigned int> _single_precision_prop_ids;
 
   unsigned int addPropertyId (const std::string & prop_name);
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
+
+  /**
+   * Allocate the storage of an old or older property, in single precision if requested
+   * @param from The old or older properties in MaterialData
+   * @param stateful_id Index into _stateful_prop_id_to_prop_id
+   * @param n_qpoints Number of quadrature points
+   */
+  PropertyValue * initStatefulProp(MaterialProperties & from, unsigned int stateful_id, unsigned int n_qpoints);
+
+  /**
+   * After shift() the current properties reuse the storage of the old (or older) ones, this puts the
+   * double precision values back in the current properties and the converted values in the old ones
+   */
+  void shiftSinglePrecisionProps();
+
+  /// Bytes held by one level ([element][side]->material_properties) of the storage
+  static std::size_t propertyBytes(HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & props);
 };
 
 
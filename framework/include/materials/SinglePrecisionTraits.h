@@ -0,0 +1,64 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SINGLEPRECISIONTRAITS_H
+#define SINGLEPRECISIONTRAITS_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/vector_value.h"
+#include "libmesh/tensor_value.h"
+
+/**
+ * Access to the Real components of a material property type, used for storing the old and older
+ * values of stateful properties in single precision (see the single_precision_properties parameter
+ * of Material).
+ *
+ * Types without a specialization (n_components = 0) can not be stored in single precision.  Other
+ * fixed size types (e.g. the tensors in the modules) are enabled by specializing this next to them.
+ */
+template<typename T>
+struct SinglePrecisionTraits
+{
+  static const unsigned int n_components = 0;
+  static Real get(const T & /*value*/, unsigned int /*i*/) { return 0.; }
+  static void set(T & /*value*/, unsigned int /*i*/, Real /*component*/) {}
+};
+
+template<>
+struct SinglePrecisionTraits<Real>
+{
+  static const unsigned int n_components = 1;
+  static Real get(const Real & value, unsigned int /*i*/) { return value; }
+  static void set(Real & value, unsigned int /*i*/, Real component) { value = component; }
+};
+
+template<>
+struct SinglePrecisionTraits<RealVectorValue>
+{
+  static const unsigned int n_components = LIBMESH_DIM;
+  static Real get(const RealVectorValue & value, unsigned int i) { return value(i); }
+  static void set(RealVectorValue & value, unsigned int i, Real component) { value(i) = component; }
+};
+
+template<>
+struct SinglePrecisionTraits<RealTensorValue>
+{
+  static const unsigned int n_components = LIBMESH_DIM * LIBMESH_DIM;
+  static Real get(const RealTensorValue & value, unsigned int i) { return value(i / LIBMESH_DIM, i % LIBMESH_DIM); }
+  static void set(RealTensorValue & value, unsigned int i, Real component) { value(i / LIBMESH_DIM, i % LIBMESH_DIM) = component; }
+};
+
+#endif /* SINGLEPRECISIONTRAITS_H */
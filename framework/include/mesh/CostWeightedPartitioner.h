@@ -0,0 +1,62 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COSTWEIGHTEDPARTITIONER_H
+#define COSTWEIGHTEDPARTITIONER_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/partitioner.h"
+
+#include <vector>
+
+/**
+ * Partitions the active elements along a Morton (Z-order) space filling curve through
+ * their centroids, cutting the curve into pieces of equal total cost instead of equal
+ * element count.
+ *
+ * The costs are indexed by element id and must be identical on all processors (e.g.
+ * summed over the communicator).  Elements without a measured cost are assigned the
+ * average cost of the measured ones.
+ */
+class CostWeightedPartitioner : public Partitioner
+{
+public:
+  CostWeightedPartitioner(const std::vector<Real> & costs);
+
+  virtual AutoPtr<Partitioner> clone() const;
+
+  /**
+   * The total cost of the active elements owned by each processor with the current partitioning
+   * @param mesh The mesh
+   * @param n_parts The number of partitions
+   * @return Cost per partition
+   */
+  std::vector<Real> partitionCosts(const MeshBase & mesh, unsigned int n_parts) const;
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n);
+
+  /// The cost of an element, or default_cost if it was not measured
+  Real elemCost(const Elem * elem, Real default_cost) const;
+
+  /// The average of the measured costs over the active elements
+  Real averageCost(const MeshBase & mesh) const;
+
+  /// The cost of each element, indexed by element id
+  const std::vector<Real> & _costs;
+};
+
+#endif /* COSTWEIGHTEDPARTITIONER_H */
@@ -22,6 +22,8 @@
 #include "MooseTypes.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "CompressedAdjacency.h"
+#include "MemoryUsage.h"
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -67,7 +69,8 @@ public:
  */
 class MooseMesh :
   public MooseObject,
-  public Restartable
+  public Restartable,
+  public MemoryUsageReporter
 {
 public:
   /**
@@ -135,6 +138,19 @@ public:
    */
   std::map<unsigned int, std::vector<unsigned int> > & nodeToElemMap();
 
+  /**
+   * The ids of the elements connected to each node in compressed row form.
+   * This is built on first use and again after the mesh changes, and is
+   * much smaller and faster to build than nodeToElemMap().
+   */
+  const CompressedAdjacency & nodeToElemConnectivity();
+
+  /**
+   * The ids of the nodes connected to each node by an element edge (the same
+   * neighbors MeshTools::find_nodal_neighbors() returns) in compressed row form.
+   */
+  const CompressedAdjacency & nodeToNodeConnectivity();
+
   /**
    * These structs are required so that the bndNodes{Begin,End} and
    * bndElems{Begin,End} functions work...
@@ -386,6 +402,11 @@ public:
   MeshBase & getMesh();
   const MeshBase & getMesh() const;
 
+  /**
+   * Reports the libMesh mesh together with the connectivity and boundary data cached here as "Mesh"
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage);
+
   /**
    * Not implemented -- always returns NULL.
    */
@@ -757,6 +778,10 @@ protected:
   std::map<unsigned int, std::vector<unsigned int> > _node_to_elem_map;
   bool _node_to_elem_map_built;
 
+  /// Compressed node to element and node to node connectivity
+  CompressedAdjacency _node_to_elem_connectivity;
+  CompressedAdjacency _node_to_node_connectivity;
+
   /**
    * A set of subdomain IDs currently present in the mesh.
    * For parallel meshes, includes subdomains defined on other
@@ -18,6 +18,7 @@
 #include "MooseEnum.h"
 #include "SetupInterface.h"
 #include "Restartable.h"
+#include "MultiAppInputCache.h"
 
 // libMesh includes
 #include "libmesh/mesh_tools.h"
@@ -222,6 +223,25 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Split the apps into contiguous ranges of about equal total cost, one range per processor
+   * (used when there are at least as many apps as processors).
+   * @return The first app of each processor followed by the total number of apps
+   */
+  std::vector<unsigned int> balanceAppsOverProcs() const;
+
+  /**
+   * Give each app a number of processors proportional to its cost (used when there are more
+   * processors than apps).
+   * @return The number of processors for each app
+   */
+  std::vector<unsigned int> balanceProcsOverApps() const;
+
+  /**
+   * Print which processors work on which apps when they are distributed by 'app_costs'.
+   */
+  void printAppDistribution();
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -285,6 +305,9 @@ protected:
   /// Maximum number of processors to give to each app
   unsigned int _max_procs_per_app;
 
+  /// The (relative) cost of each app used to balance the apps over the processors
+  std::vector<Real> _app_costs;
+
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
@@ -311,6 +334,12 @@ protected:
 
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
+
+  /// Whether the local apps share parsed input files and meshes read from files
+  bool _reuse_inputs;
+
+  /// Parsed input files and meshes shared by the local apps
+  MooseSharedPointer<MultiAppInputCache> _input_cache;
 };
 
 #endif // MULTIAPP_H
@@ -0,0 +1,81 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MULTIAPPINPUTCACHE_H
+#define MULTIAPPINPUTCACHE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/getpot.h"
+#include "libmesh/parallel.h"
+#include "libmesh/unstructured_mesh.h"
+
+#include <map>
+#include <string>
+
+/**
+ * Parsed input files and meshes read from files, shared by the sibling sub-apps of a MultiApp
+ * on one processor so that every file is only read once.
+ *
+ * The meshes are stored in their own objects (living on a communicator owned by the cache) so
+ * they stay valid when the app that read them is destroyed.
+ */
+class MultiAppInputCache
+{
+public:
+  /**
+   * @param comm The communicator of the sub-apps using this cache
+   */
+  MultiAppInputCache(const MPI_Comm & comm);
+  virtual ~MultiAppInputCache();
+
+  /**
+   * The parsed contents of an input file or NULL if it was not parsed yet
+   */
+  const GetPot * parsedInput(const std::string & file_name) const;
+
+  /**
+   * Store the parsed contents of an input file
+   */
+  void addParsedInput(const std::string & file_name, const GetPot & getpot);
+
+  /**
+   * Copy a mesh previously read from a file into mesh
+   * @return false if the file was not read yet
+   */
+  bool copyMesh(const std::string & file_name, UnstructuredMesh & mesh) const;
+
+  /**
+   * Store a copy of a mesh just read from a file
+   */
+  void addMesh(const std::string & file_name, const UnstructuredMesh & mesh);
+
+  /**
+   * Copy the elements, nodes, boundary information and block/boundary names of a mesh into an empty mesh
+   */
+  static void copyMeshData(const UnstructuredMesh & from, UnstructuredMesh & to);
+
+protected:
+  /// Communicator of the cached meshes
+  Parallel::Communicator _comm;
+
+  /// Parsed input files
+  std::map<std::string, GetPot> _parsed_inputs;
+
+  /// Meshes read from files
+  std::map<std::string, UnstructuredMesh *> _meshes;
+};
+
+#endif /* MULTIAPPINPUTCACHE_H */
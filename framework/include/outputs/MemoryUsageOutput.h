@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MEMORYUSAGEOUTPUT_H
+#define MEMORYUSAGEOUTPUT_H
+
+// MOOSE includes
+#include "Output.h"
+
+// Forward declerations
+class MemoryUsageOutput;
+
+template<>
+InputParameters validParams<MemoryUsageOutput>();
+
+/**
+ * Prints the memory used by each subsystem (mesh, DOF maps, vectors, matrices, stateful material
+ * properties, FE caches and geometric search data) as the minimum, maximum and average over the
+ * processors, together with the resident set size and its high-water mark.
+ *
+ * This class may be used from inside the [Outputs] block or via the [Debug] block (show_memory_usage)
+ */
+class MemoryUsageOutput : public Output
+{
+public:
+
+  /**
+   * Class constructor
+   * @param name Output object name
+   * @param parameters Object input parameters
+   */
+  MemoryUsageOutput(const std::string & name, InputParameters & parameters);
+
+  /**
+   * Class destructor
+   */
+  virtual ~MemoryUsageOutput();
+
+protected:
+
+  /**
+   * Gather and print the memory usage table
+   */
+  virtual void output();
+};
+
+#endif // MEMORYUSAGEOUTPUT_H
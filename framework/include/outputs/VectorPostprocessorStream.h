@@ -0,0 +1,83 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef VECTORPOSTPROCESSORSTREAM_H
+#define VECTORPOSTPROCESSORSTREAM_H
+
+// MOOSE includes
+#include "FileOutput.h"
+
+// Forward declerations
+class VectorPostprocessorStream;
+
+template<>
+InputParameters validParams<VectorPostprocessorStream>();
+
+/**
+ * Appends the vectors of each VectorPostprocessor to a single binary file per VectorPostprocessor
+ * (<file_base>_<name>.vpp) instead of writing a new CSV file every output step.
+ *
+ * The file starts with the 8 characters "MOOSEVPP" and a 32 bit format version, followed by one
+ * record per output step (native byte order):
+ *   int32 time step, float64 time, uint32 number of vectors, and for each vector
+ *   uint32 name length, the name followed by a NUL, uint32 number of values and the float64 values.
+ *
+ * Every record is listed in the text file <file_base>_<name>.vpp.index ("time_step,time,offset"),
+ * so readers can seek to a step and pick up new records while the simulation runs.  The files are
+ * only written by the first processor.  When recovering, the records written after the checkpoint
+ * are dropped before appending.
+ */
+class VectorPostprocessorStream : public FileOutput
+{
+public:
+
+  /**
+   * Class constructor
+   * @param name Output object name
+   * @param parameters Object input parameters
+   */
+  VectorPostprocessorStream(const std::string & name, InputParameters & parameters);
+
+  /**
+   * Class destructor
+   */
+  virtual ~VectorPostprocessorStream();
+
+protected:
+
+  /**
+   * Append the current vectors of every VectorPostprocessor to its file
+   */
+  virtual void outputVectorPostprocessors();
+
+  /**
+   * Create the files of a VectorPostprocessor, or cut them back to the size recorded in the
+   * checkpoint when recovering
+   */
+  void openFiles(const std::string & vpp_name, const std::string & data_file, const std::string & index_file);
+
+  /// The size of the data file of each VectorPostprocessor
+  std::map<std::string, unsigned long> & _data_sizes;
+
+  /// The size of the index file of each VectorPostprocessor
+  std::map<std::string, unsigned long> & _index_sizes;
+
+  /// The last time step appended for each VectorPostprocessor in this run
+  std::map<std::string, int> _last_time_step;
+
+  /// Whether the files were written before the checkpoint this run recovered from
+  bool _recovering;
+};
+
+#endif // VECTORPOSTPROCESSORSTREAM_H
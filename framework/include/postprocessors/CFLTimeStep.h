@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef CFLTIMESTEP_H
+#define CFLTIMESTEP_H
+
+#include "ElementPostprocessor.h"
+
+//Forward Declarations
+class CFLTimeStep;
+
+template<>
+InputParameters validParams<CFLTimeStep>();
+
+/**
+ * Estimates the largest stable time step of an explicit scheme for diffusion,
+ * cfl * h_min^2 / (2 * dim * D) minimized over the elements, e.g. to be used with PostprocessorDT.
+ */
+class CFLTimeStep : public ElementPostprocessor
+{
+public:
+  CFLTimeStep(const std::string & name, InputParameters parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual Real getValue();
+  virtual void threadJoin(const UserObject & y);
+
+protected:
+  /// Safety factor applied to the stability limit
+  Real _cfl;
+
+  /// The diffusivity
+  MaterialProperty<Real> & _diffusivity;
+
+  /// The smallest stable time step found so far
+  Real _value;
+};
+
+#endif // CFLTIMESTEP_H
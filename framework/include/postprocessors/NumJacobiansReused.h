@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMJACOBIANSREUSED_H
+#define NUMJACOBIANSREUSED_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumJacobiansReused;
+
+template<>
+InputParameters validParams<NumJacobiansReused>();
+
+/**
+ * Returns the total number of Jacobian evaluations that reused the previous Jacobian
+ * (constant or lagged Jacobians) instead of assembling it.
+ */
+class NumJacobiansReused : public GeneralPostprocessor
+{
+public:
+  NumJacobiansReused(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  /**
+   * This will return the number of reused Jacobians.
+   */
+  virtual Real getValue();
+};
+
+#endif //NUMJACOBIANSREUSED_H
@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef NUMSKIPPEDSEARCHUPDATES_H
+#define NUMSKIPPEDSEARCHUPDATES_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumSkippedSearchUpdates;
+
+template<>
+InputParameters validParams<NumSkippedSearchUpdates>();
+
+/**
+ * Returns the total number of displaced mesh updates that did not rebuild the DiracKernel
+ * point locator because the nodes moved less than displaced_search_update_tolerance.
+ */
+class NumSkippedSearchUpdates : public GeneralPostprocessor
+{
+public:
+  NumSkippedSearchUpdates(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  /**
+   * This will return the number of skipped updates, zero without a displaced mesh.
+   */
+  virtual Real getValue();
+};
+
+#endif //NUMSKIPPEDSEARCHUPDATES_H
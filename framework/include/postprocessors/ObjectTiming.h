@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMING_H
+#define OBJECTTIMING_H
+
+#include "GeneralPostprocessor.h"
+#include "ObjectTimings.h"
+
+//Forward Declarations
+class ObjectTiming;
+
+template<>
+InputParameters validParams<ObjectTiming>();
+
+/**
+ * The time spent in one method of a kernel, material, aux kernel or user object, summed over
+ * threads and processors (requires object_timing = true in the Problem block).
+ */
+class ObjectTiming : public GeneralPostprocessor
+{
+public:
+  ObjectTiming(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  virtual Real getValue();
+
+protected:
+  /// The measured timings
+  ObjectTimings * _timings;
+
+  /// Name of the timed object
+  std::string _object;
+
+  /// The timed method
+  ObjectTimings::Phase _phase;
+
+  MooseEnum _column;
+};
+
+#endif // OBJECTTIMING_H
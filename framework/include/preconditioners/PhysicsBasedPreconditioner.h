@@ -80,6 +80,17 @@ public:
   virtual void setup ();
 
 protected:
+  /**
+   * Collect the dofs of the local nodes and elements of every variable in the nonlinear system and
+   * in its preconditioning system, so apply() can copy the vectors without traversing the mesh
+   */
+  void buildDofMaps();
+
+  /**
+   * Append the dofs of one node or element to the dof maps
+   */
+  void addDofs(const DofObject & dof_object);
+
   /// The nonlinear system this PBP is associated with (convenience reference)
   NonlinearSystem & _nl;
   /// List of linear system that build up the preconditioner
@@ -101,6 +112,13 @@ protected:
    * to keep looking this thing up through it's name.
    */
   std::vector<std::vector<SparseMatrix<Number> *> > _off_diag_mats;
+
+  /// Local dofs of each variable in the nonlinear system, built in setup()
+  std::vector<std::vector<dof_id_type> > _nl_dofs;
+  /// The matching dofs in the preconditioning system of each variable
+  std::vector<std::vector<dof_id_type> > _block_dofs;
+  /// Perf log entries of the block solves
+  std::vector<std::string> _block_perf_names;
 };
 
 #endif //PHYSICSBASEDPRECONDITIONER_H
@@ -18,6 +18,7 @@
 #include "MooseObject.h"
 #include "libmesh/numeric_vector.h"
 #include "Restartable.h"
+#include "MeshChangedInterface.h"
 
 class TimeIntegrator;
 class FEProblem;
@@ -39,7 +40,8 @@ InputParameters validParams<TimeIntegrator>();
  */
 class TimeIntegrator :
   public MooseObject,
-  public Restartable
+  public Restartable,
+  public MeshChangedInterface
 {
 public:
   TimeIntegrator(const std::string & name, InputParameters parameters);
@@ -54,7 +56,24 @@ public:
   virtual int order() = 0;
   virtual void computeTimeDerivatives() = 0;
 
+  virtual void meshChanged();
+
+  /// Whether the solution is updated with a lumped mass instead of calling the nonlinear solver
+  bool lumpedMass() const { return _lumped_mass; }
+
 protected:
+  /**
+   * Solve for the solution of the current stage.  With a lumped mass this is a single update
+   * u -= R(u) / diag(J) using only residual evaluations, otherwise the nonlinear solver is called.
+   */
+  void solveStage();
+
+  /**
+   * Compute the row sums of the Jacobian (the lumped mass over dt, one for nodal boundary conditions)
+   * and store their reciprocal in _lumped_inverse
+   */
+  void computeLumpedDiagonal();
+
 
   FEProblem & _fe_problem;
   SystemBase & _sys;
@@ -78,6 +97,13 @@ protected:
   NumericVector<Number> & _Re_time;
   /// residual vector for non-time contributions
   NumericVector<Number> & _Re_non_time;
+
+  /// Whether the mass is lumped and the solution updated explicitly
+  bool _lumped_mass;
+  /// Reciprocal of the lumped diagonal of the Jacobian
+  NumericVector<Number> * _lumped_inverse;
+  /// Time step the lumped diagonal was computed with, zero if it has to be recomputed
+  Real _lumped_dt;
 };
 
 #endif /* TIMEINTEGRATOR_H */
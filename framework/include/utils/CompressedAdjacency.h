@@ -0,0 +1,99 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDADJACENCY_H
+#define COMPRESSEDADJACENCY_H
+
+#include "libmesh/id_types.h"
+
+#include <vector>
+#include <map>
+
+/**
+ * Adjacency lists (e.g. node to element connectivity) stored in compressed row
+ * format: the entries of row r are _entries[_offsets[r]] ... _entries[_offsets[r+1]-1].
+ *
+ * The dense rows are built in two passes, first counting the entries of every
+ * row with countEntry(), then filling them with insertEntry() after allocate().
+ * Alternatively rows can be added in order with appendRow().  Rows with ids
+ * beyond the dense range (e.g. quadrature nodes) may be added with appendEntry()
+ * at any time and are kept in a separate map.
+ */
+class CompressedAdjacency
+{
+public:
+  CompressedAdjacency();
+
+  /**
+   * Remove all rows
+   */
+  void clear();
+
+  /**
+   * Whether the dense rows have been built
+   */
+  bool built() const { return _built; }
+
+  /**
+   * The number of entries in a row (zero for rows that were never set)
+   */
+  unsigned int size(dof_id_type row) const;
+
+  /**
+   * Pointers to the first and one past the last entry of a row
+   */
+  const dof_id_type * begin(dof_id_type row) const;
+  const dof_id_type * end(dof_id_type row) const;
+
+  /**
+   * Two pass construction of the dense rows 0 ... n_rows-1
+   */
+  void reserveRows(dof_id_type n_rows);
+  void countEntry(dof_id_type row) { ++_offsets[row + 1]; }
+  void allocate();
+  void insertEntry(dof_id_type row, dof_id_type value) { _entries[_fill[row]++] = value; }
+  void finalize();
+
+  /**
+   * Add the next dense row (rows must be appended in order after reserveRows(0))
+   */
+  void appendRow(const std::vector<dof_id_type> & values);
+
+  /**
+   * Add an entry to a row outside of the dense range
+   */
+  void appendEntry(dof_id_type row, dof_id_type value);
+
+  /**
+   * Memory used by this object in bytes
+   */
+  unsigned long int bytes() const;
+
+protected:
+  /// Row offsets into _entries, one more than the number of dense rows
+  std::vector<dof_id_type> _offsets;
+
+  /// The entries of all dense rows
+  std::vector<dof_id_type> _entries;
+
+  /// Insertion position of each row while filling
+  std::vector<dof_id_type> _fill;
+
+  /// Rows outside of the dense range
+  std::map<dof_id_type, std::vector<dof_id_type> > _extra_rows;
+
+  bool _built;
+};
+
+#endif //COMPRESSEDADJACENCY_H
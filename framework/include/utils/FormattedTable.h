@@ -151,6 +151,21 @@ protected:
   /// Whether or not to output the Time column
   bool _output_time;
 
+  /**
+   * State of the rows already written by printCSV, used to append only the new
+   * rows instead of rewriting the whole file on every call
+   */
+  /// True if the file has to be rewritten from the start (new columns, cleared or reordered data)
+  bool _csv_rewrite;
+  /// Key and interval index of the last row written
+  Real _csv_last_key;
+  unsigned int _csv_last_row_index;
+  /// Output interval used for the rows in the file
+  int _csv_interval;
+  /// File positions of the start of the last row and of the end of the data
+  std::streampos _csv_last_row_pos;
+  std::streampos _csv_end_pos;
+
 private:
 
   /// *.csv file delimiter, defaults to ","
@@ -0,0 +1,131 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/numeric_vector.h"
+#include "libmesh/sparse_matrix.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// libMesh forward declarations
+namespace libMesh
+{
+class MeshBase;
+class DofMap;
+class System;
+}
+
+/// Bytes used by each subsystem (e.g. "Mesh", "Sparse matrices"), the key is the name of the subsystem
+typedef std::map<std::string, std::size_t> MemoryUsageMap;
+
+/**
+ * Interface of the containers reporting their memory footprint to the MemoryUsageOutput.
+ *
+ * The reported numbers are estimates computed from the sizes of the stored data (allocator
+ * overhead and fragmentation are not included), they are meant for finding out which
+ * subsystem dominates the memory usage.
+ */
+class MemoryUsageReporter
+{
+public:
+  virtual ~MemoryUsageReporter() {}
+
+  /**
+   * Add the number of bytes held by this object on this processor to the subsystem(s) it belongs to
+   * @param usage The bytes used by each subsystem
+   */
+  virtual void reportMemoryUsage(MemoryUsageMap & usage) = 0;
+};
+
+/**
+ * Helpers for estimating the memory used by the standard and libMesh containers
+ */
+namespace MemoryUsage
+{
+/// Estimated overhead of a node in a std::map/std::set (color and three pointers)
+const std::size_t TREE_NODE_OVERHEAD = 4 * sizeof(void *);
+
+template<typename T>
+std::size_t
+bytes(const std::vector<T> & v)
+{
+  return sizeof(T) * v.capacity();
+}
+
+template<typename T>
+std::size_t
+bytes(const std::set<T> & s)
+{
+  return s.size() * (sizeof(T) + TREE_NODE_OVERHEAD);
+}
+
+template<typename K, typename V>
+std::size_t
+bytes(const std::map<K, V> & m)
+{
+  return m.size() * (sizeof(std::pair<const K, V>) + TREE_NODE_OVERHEAD);
+}
+
+/**
+ * Elements and nodes stored on this processor (including ancestors and ghosts) and the side boundary ids
+ */
+std::size_t meshBytes(const MeshBase & mesh);
+
+/**
+ * The dof indices, send list, sparsity counts and constraints of a DofMap
+ */
+std::size_t dofMapBytes(const DofMap & dof_map);
+
+/**
+ * The locally stored entries (including ghosts) of a vector
+ * @param vec The vector
+ * @param n_ghosts Number of ghost entries stored if the vector is ghosted
+ */
+std::size_t vectorBytes(const NumericVector<Number> & vec, std::size_t n_ghosts);
+
+/**
+ * All the vectors of a system (solution, current_local_solution and the added vectors)
+ */
+std::size_t systemVectorBytes(System & sys);
+
+/**
+ * The locally allocated nonzeros of a matrix, zero if the matrix is not a PETSc matrix
+ */
+std::size_t matrixBytes(SparseMatrix<Number> & mat);
+
+/**
+ * The maximum resident set size of this process so far (high-water mark) in bytes
+ */
+std::size_t peakResidentBytes();
+
+/**
+ * The current resident set size of this process in bytes, zero if not available on this platform
+ */
+std::size_t currentResidentBytes();
+
+/**
+ * Format a number of bytes with a binary prefix (e.g. "1.5 GB")
+ */
+std::string formatBytes(Real bytes);
+}
+
+#endif /* MEMORYUSAGE_H */
@@ -157,7 +157,8 @@ enum SolveType
   ST_JFNK,             ///< Jacobian-Free Newton Krylov
   ST_NEWTON,           ///< Full Newton Solve
   ST_FD,               ///< Use finite differences to compute Jacobian
-  ST_LINEAR            ///< Solving a linear problem
+  ST_LINEAR,           ///< Solving a linear problem
+  ST_MATRIX_FREE       ///< Newton Krylov with the Jacobian action applied element by element
 };
 
 /**
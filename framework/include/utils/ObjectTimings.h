@@ -0,0 +1,150 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMINGS_H
+#define OBJECTTIMINGS_H
+
+#include "Moose.h"
+#include "ParallelUniqueId.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+class MooseObject;
+
+/**
+ * Time spent in the compute methods of individual objects (kernels, materials, aux kernels
+ * and user objects), accumulated separately by every thread so the threaded loops do not
+ * need to synchronize.
+ */
+class ObjectTimings
+{
+public:
+  /// The methods that are timed separately
+  enum Phase
+  {
+    RESIDUAL = 0,
+    JACOBIAN,
+    COMPUTE,
+    EXECUTE,
+    FINALIZE,
+    N_PHASES
+  };
+
+  /// The time spent in one method of one object
+  struct Entry
+  {
+    std::string _name;
+    Phase _phase;
+    Real _time;
+    Real _calls;
+  };
+
+  ObjectTimings(unsigned int n_threads);
+
+  /// Monotonic wall clock time in seconds
+  static inline Real clock()
+  {
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase;
+    if (timebase.denom == 0)
+      mach_timebase_info(&timebase);
+    return static_cast<Real>(mach_absolute_time()) * timebase.numer / timebase.denom * 1.e-9;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<Real>(ts.tv_sec) + static_cast<Real>(ts.tv_nsec) * 1.e-9;
+#endif
+  }
+
+  /// Add the time of one call of a method of an object on thread tid
+  void add(THREAD_ID tid, const MooseObject * object, Phase phase, Real time);
+
+  /**
+   * The time and number of calls of a method of the objects named name, summed over the local threads
+   */
+  void localTotal(const std::string & name, Phase phase, Real & time, Real & calls) const;
+
+  /**
+   * The timings summed over threads and processors, sorted by decreasing time.
+   * This must be called on all processors.
+   */
+  std::vector<Entry> gather(const Parallel::Communicator & comm) const;
+
+  /// Write the gathered timings as a table
+  static void print(std::ostream & out, const std::vector<Entry> & entries);
+
+  /// The name of a phase as used in the table and by the ObjectTiming postprocessor
+  static std::string phaseName(Phase phase);
+
+  /// Forget all the recorded timings
+  void clear();
+
+protected:
+  /// Accumulated time and number of calls
+  struct Timing
+  {
+    Timing() : _time(0.), _calls(0.) {}
+    Real _time;
+    Real _calls;
+  };
+
+  typedef std::map<std::pair<const MooseObject *, Phase>, Timing> TimingMap;
+
+  /// The timings of every thread
+  std::vector<TimingMap> _timings;
+};
+
+/**
+ * Adds the time between its construction and destruction to an object's timing.
+ * Does nothing (beyond a test) when the timings are NULL, i.e. not being measured.
+ */
+class ObjectTimer
+{
+public:
+  ObjectTimer(ObjectTimings * timings, THREAD_ID tid, const MooseObject * object, ObjectTimings::Phase phase) :
+      _timings(timings),
+      _tid(tid),
+      _object(object),
+      _phase(phase),
+      _start(timings ? ObjectTimings::clock() : 0.)
+  {
+  }
+
+  ~ObjectTimer()
+  {
+    if (_timings)
+      _timings->add(_tid, _object, _phase, ObjectTimings::clock() - _start);
+  }
+
+protected:
+  ObjectTimings * _timings;
+  THREAD_ID _tid;
+  const MooseObject * _object;
+  ObjectTimings::Phase _phase;
+  Real _start;
+};
+
+#endif /* OBJECTTIMINGS_H */
@@ -25,6 +25,13 @@ class PointSamplerBase;
 template<>
 InputParameters validParams<PointSamplerBase>();
 
+/**
+ * Samples variables at a fixed set of points.
+ *
+ * The element containing each point and the reference coordinates of the point are cached until
+ * the mesh changes, all points in an element are evaluated with a single reinit and the output
+ * order of the points is only computed once.
+ */
 class PointSamplerBase :
   public GeneralVectorPostprocessor,
   public CoupleableMooseVariableDependencyIntermediateInterface,
@@ -41,6 +48,8 @@ public:
 
   virtual void threadJoin(const SamplerBase & y);
 
+  virtual void meshChanged();
+
 protected:
 
   /**
@@ -52,6 +61,16 @@ protected:
    */
   const Elem * getLocalElemContainingPoint(const Point & p, unsigned int /*id*/);
 
+  /**
+   * Find the local elements containing the points and the reference coordinates of the points in them
+   */
+  void locatePoints();
+
+  /**
+   * Compute the output order of the points (the order of _points sorted by "sort_by")
+   */
+  void sortPoints();
+
   /// The Mesh we're using
   MooseMesh & _mesh;
 
@@ -61,15 +80,30 @@ protected:
   /// The ID to use for each point (yes, this is Real on purpose)
   std::vector<Real> _ids;
 
-  /// So we don't have to create and destroy this vector over and over again
-  std::vector<Real> _values;
-
   unsigned int _qp;
 
   /// So we don't have to create and destroy this
   std::vector<Point> _point_vec;
 
   AutoPtr<PointLocatorBase> _pl;
+
+  /// Whether the sampled values are gathered to every processor or only to the one writing the output
+  bool _replicate_values;
+
+  /// Whether the points have to be located again before sampling
+  bool _locate_points;
+
+  /// The local elements containing points and the indices of the points in each of them
+  std::map<const Elem *, std::vector<unsigned int> > _elem_points;
+
+  /// The reference coordinates of each point in the element containing it
+  std::vector<Point> _reference_points;
+
+  /// Indices of the points in output order
+  std::vector<size_t> _sorted_points;
+
+  /// The points sampled on this processor: the index of the point followed by the value of each variable
+  std::vector<Real> _samples;
 };
 
 #endif
@@ -27,6 +27,10 @@ protected:
 
   virtual Real computeQpJacobian();
 
+  virtual bool hasWeakForm();
+  virtual void computeWeakFormResidual();
+  virtual void computeWeakFormJacobian();
+
 private:
   const unsigned _dim;
   MaterialProperty<Real> & _diffusion_coefficient;
@@ -90,6 +90,10 @@
     boundary = rightleft
     diffusivity = thermal_conductivity
   [../]
+  [./skipped_search_updates]
+    type = NumSkippedSearchUpdates
+    outputs = console
+  [../]
 []
 
 [Executioner]
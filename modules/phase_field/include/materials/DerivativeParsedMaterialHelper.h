@@ -33,13 +33,16 @@ public:
                      const std::vector<Real> & tol_values);
 
 protected:
+  /// Shorthand for an autodiff function parser object.
+  typedef FunctionParserADBase<Real> ADFunction;
+
   virtual void computeProperties();
 
   void functionsDerivative();
   void functionsOptimize();
 
-  /// Shorthand for an autodiff function parser object.
-  typedef FunctionParserADBase<Real> ADFunction;
+  /// Optimize (and optionally JIT compile) a single function, deleting vanishing derivatives
+  void functionOptimize(ADFunction * & parser);
 
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunction *);
@@ -230,9 +230,6 @@ protected:
   /// The data structure used to marshall the data between processes and/or threads
   std::vector<unsigned int> _packed_data;
 
-  /// The data structure used to find neighboring elements give a node ID
-  std::vector< std::vector< const Elem * > > _nodes_to_elem_map;
-
   /// This data structure is used to keep track of which bubbles are owned by which variables (index).
   std::vector<unsigned int> _region_to_var_idx;
 
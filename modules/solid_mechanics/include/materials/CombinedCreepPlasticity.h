@@ -25,6 +25,13 @@ public:
                               SymmTensor & strain_increment,
                               SymmTensor & stress_new );
 
+  /// Compute the stress at all qps, looking up the submodels once per element
+  virtual void computeElementStress( const Elem & current_elem,
+                                     const std::vector<SymmElasticityTensor*> & elasticity_tensor,
+                                     const std::vector<SymmTensor> & stress_old,
+                                     std::vector<SymmTensor> & strain_increment,
+                                     MaterialProperty<SymmTensor> & stress_new );
+
   virtual bool modifyStrainIncrement(const Elem & current_elem,
                                      unsigned qp,
                                      SymmTensor & strain_increment,
@@ -42,6 +49,14 @@ protected:
 
 private:
 
+  void computeQpStress( const Elem & current_elem,
+                        unsigned qp,
+                        const std::vector<ReturnMappingModel*> & rmm,
+                        const SymmElasticityTensor & elasticityTensor,
+                        const SymmTensor & stress_old,
+                        SymmTensor & strain_increment,
+                        SymmTensor & stress_new );
+
 };
 
 template<>
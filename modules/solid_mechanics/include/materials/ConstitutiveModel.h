@@ -26,6 +26,18 @@ public:
                               SymmTensor & strain_increment,
                               SymmTensor & stress_new );
 
+  /**
+   * Compute the stress at every quadrature point of an element in one call.
+   * The default implementation forwards to the per-qp computeStress().  Models
+   * that can share work across quadrature points may override this instead.
+   * elasticity_tensor holds the local elasticity tensor of every qp.
+   */
+  virtual void computeElementStress( const Elem & current_elem,
+                                     const std::vector<SymmElasticityTensor*> & elasticity_tensor,
+                                     const std::vector<SymmTensor> & stress_old,
+                                     std::vector<SymmTensor> & strain_increment,
+                                     MaterialProperty<SymmTensor> & stress_new );
+
   virtual bool modifyStrainIncrement(const Elem & /*elem*/,
                                      unsigned qp,
                                      SymmTensor & strain_increment,
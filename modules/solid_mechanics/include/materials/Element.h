@@ -58,6 +58,15 @@ public:
   /// Rotate stress to current configuration
   virtual void finalizeStress( std::vector<SymmTensor*> & /*t*/ ) {}
 
+  /**
+   * Rotate stress at qp to current configuration.  Unlike the version above,
+   * this may be called after computeStrain() has been called for later qps.
+   */
+  virtual void finalizeStress( unsigned /*qp*/, std::vector<SymmTensor*> & t )
+  {
+    finalizeStress( t );
+  }
+
   virtual unsigned int getNumKnownCrackDirs() const
   {
     return 0;
@@ -50,6 +50,7 @@ protected:
   DecompMethod _decomp_method;
 
   ColumnMajorMatrix _incremental_rotation;
+  std::vector<ColumnMajorMatrix> _qp_incremental_rotation;
   ColumnMajorMatrix _Uhat;
 
   std::vector<ColumnMajorMatrix> _Fhat;
@@ -69,6 +70,7 @@ protected:
 
   /// Rotate stress to current configuration
   virtual void finalizeStress( std::vector<SymmTensor*> & t );
+  virtual void finalizeStress( unsigned qp, std::vector<SymmTensor*> & t );
 
 
   void computeIncrementalDeformationGradient( std::vector<ColumnMajorMatrix> & Fhat);
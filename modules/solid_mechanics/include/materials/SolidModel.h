@@ -139,6 +139,16 @@ protected:
   SymmTensor _total_strain_increment;
   SymmTensor _strain_increment;
 
+  /// Per-qp copies of the scratch tensors above, used when the constitutive model is called once per element
+  std::vector<SymmTensor> _qp_total_strain_increment;
+  std::vector<SymmTensor> _qp_strain_increment;
+  std::vector<SymmTensor> _qp_stress_old;
+  std::vector<SymmTensor> _qp_d_strain_dT;
+  std::vector<SymmElasticityTensor*> _qp_elasticity_tensor;
+
+  /// Whether the constitutive model is called once per element instead of once per qp
+  const bool _element_stress_update;
+
   const bool _compute_JIntegral;
 
   //These are used in calculation of the J integral
@@ -249,11 +259,20 @@ protected:
   /// Compute the stress (sigma += deltaSigma)
   virtual void computeConstitutiveModelStress();
 
+  /// Compute the stress at all qps of the current element with a single constitutive model call
+  void computeElementConstitutiveModelStress();
+
   void createConstitutiveModel(const std::string & cm_name, const InputParameters & params);
 
 
 private:
 
+  /// Strain increment, elasticity tensor, and old stress at _qp
+  void computeQpStrainAndElasticity();
+
+  /// Everything after the stress update at _qp
+  void finalizeQpProperties();
+
   void computeCrackStrainAndOrientation( ColumnMajorMatrix & principal_strain );
 
   SolidMechanics::Element * createElement( const std::string & name,
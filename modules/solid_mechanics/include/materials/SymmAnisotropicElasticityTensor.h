@@ -13,6 +13,16 @@ public:
 
   virtual ~SymmAnisotropicElasticityTensor() {}
 
+  virtual SymmElasticityTensor * clone() const
+  {
+    return new SymmAnisotropicElasticityTensor( *this );
+  }
+
+  virtual void assign( const SymmElasticityTensor & rhs )
+  {
+    *this = static_cast<const SymmAnisotropicElasticityTensor &>( rhs );
+  }
+
   /**
    * Set the first euler angle
    */
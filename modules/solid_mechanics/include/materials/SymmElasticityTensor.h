@@ -62,6 +62,18 @@ public:
 
   virtual ~SymmElasticityTensor() {}
 
+  /// A copy of this tensor of the same type
+  virtual SymmElasticityTensor * clone() const
+  {
+    return new SymmElasticityTensor( *this );
+  }
+
+  /// Copy a tensor of the same type into this one, reusing its storage
+  virtual void assign( const SymmElasticityTensor & rhs )
+  {
+    *this = rhs;
+  }
+
   void copyValues( SymmElasticityTensor & rhs ) const
   {
     for (unsigned i(0); i < 21; ++i)
@@ -29,6 +29,16 @@ public:
 
   virtual ~SymmIsotropicElasticityTensor() {}
 
+  virtual SymmElasticityTensor * clone() const
+  {
+    return new SymmIsotropicElasticityTensor( *this );
+  }
+
+  virtual void assign( const SymmElasticityTensor & rhs )
+  {
+    *this = static_cast<const SymmIsotropicElasticityTensor &>( rhs );
+  }
+
   void unsetConstants()
   {
     _lambda_set = _mu_set = _E_set = _nu_set = _k_set = false;
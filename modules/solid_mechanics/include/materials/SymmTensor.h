@@ -564,6 +564,22 @@ template <>
 PropertyValue *
 MaterialProperty<SymmTensor>::init (int size);
 
+/**
+ * Single precision storage of old SymmTensor properties, in the order of SymmTensor::component()
+ */
+template<>
+struct SinglePrecisionTraits<SymmTensor>
+{
+  static const unsigned int n_components = 6;
+  static Real get(const SymmTensor & value, unsigned int i) { return value.component(i); }
+  static void set(SymmTensor & value, unsigned int i, Real component)
+  {
+    static const unsigned int row[6] = {0, 1, 2, 0, 1, 2};
+    static const unsigned int col[6] = {0, 1, 2, 1, 2, 0};
+    value(row[i], col[i]) = component;
+  }
+};
+
 template<>
 void dataStore(std::ostream & stream, const SymmTensor & v, void * /*context*/);
 
@@ -129,6 +129,9 @@ protected:
   std::vector< Real > _slip_incr, _tau, _dslipdtau;
   std::vector<RankTwoTensor> _s0;
 
+  /// Derivative of the elastic deformation gradient wrt each slip increment, fixed within a step
+  std::vector<RankTwoTensor> _dfedslip;
+
 };
 
 #endif //FINITESTRAINCRYSTALPLASTICITY_H
@@ -40,6 +40,9 @@ protected:
   /// Even if the returnMap fails, return the best values found for stress and internal parameters
   bool _ignore_failures;
 
+  /// Start the return-map from the plastic multipliers (and hence active set) of the previous time step
+  bool _warm_start;
+
   /// Number of plastic models for this material
   unsigned int _num_f;
 
@@ -103,6 +106,20 @@ protected:
   /// Number of Newton-Raphson iterations used in the return-map
   MaterialProperty<Real> & _iter;
 
+  /// Plastic multipliers of the converged return-map, summed over any subdivisions of the strain increment
+  MaterialProperty<std::vector<Real> > & _pm;
+
+  /// Old value of the plastic multipliers, used as the initial guess when _warm_start is true
+  MaterialProperty<std::vector<Real> > & _pm_old;
+
+  /**
+   * How the return-map found its solution, for diagnostics:
+   * 0 = elastic, 1 = plastic from the warm start, 2 = plastic from the trial stress,
+   * 3 = plastic after subdividing the strain increment.
+   * This is really an unsigned int, but for visualisation it is converted to Real
+   */
+  MaterialProperty<Real> & _return_path;
+
   /// current value of transverse direction
   MaterialProperty<RealVectorValue> & _n;
 
@@ -312,9 +329,13 @@ protected:
    * @param f  (output) All the yield functions after returning to the yield surface
    * @param iter (output) The number of Newton-Raphson iterations used
    * @param can_revert_to_dumb  If the _deactivation_scheme is set to revert to dumb, it will only be allowed to do so if this parameter is true
+   * @param pm  Upon entry, an initial guess for the plastic multipliers: if any are positive then the Newton-Raphson process
+   *            is first tried with only those constraints active, starting from these values, and if that fails the
+   *            return is re-tried from the trial stress.  Upon successful exit, the converged plastic multipliers
+   * @param warm_start_used (output) true if the solution was found from the initial guess in pm
    * @return true if the stress was successfully returned to the yield surface
    */
-  virtual bool returnMap(const RankTwoTensor & stress_old, RankTwoTensor & stress, const std::vector<Real> & intnl_old, std::vector<Real> & intnl, const RankTwoTensor & plastic_strain_old, RankTwoTensor & plastic_strain, const RankFourTensor & E_ijkl, const RankTwoTensor & strain_increment, std::vector<Real> & f, unsigned int & iter, const bool & can_revert_to_dumb);
+  virtual bool returnMap(const RankTwoTensor & stress_old, RankTwoTensor & stress, const std::vector<Real> & intnl_old, std::vector<Real> & intnl, const RankTwoTensor & plastic_strain_old, RankTwoTensor & plastic_strain, const RankFourTensor & E_ijkl, const RankTwoTensor & strain_increment, std::vector<Real> & f, unsigned int & iter, const bool & can_revert_to_dumb, std::vector<Real> & pm, bool & warm_start_used);
 
   /**
    * Performs one Newton-Raphson step.  The purpose here is to find the
@@ -460,9 +481,11 @@ protected:
    * @param strain_increment   The applied strain increment
    * @param yf  (output) All the yield functions at (stress, intnl)
    * @param iterations (output) The total number of Newton-Raphson iterations used
+   * @param cumulative_pm Upon entry, the initial guess for the plastic multipliers passed to the first returnMap.  Upon exit, the plastic multipliers summed over all successful subdivisions of the strain increment
+   * @param return_path (output) 1 if the first returnMap succeeded from the initial guess, 2 if it succeeded from the trial stress, 3 if the strain increment had to be subdivided
    * @return true if the (stress, intnl) are admissible.  Otherwise, if _ignore_failures==true, the output variables will be the best admissible ones found during the return-map.  Otherwise, if _ignore_failures==false, this routine will perform some finite-diference checks and call mooseError
    */
-  virtual bool plasticStep(const RankTwoTensor & stress_old, RankTwoTensor & stress, const std::vector<Real> & intnl_old, std::vector<Real> & intnl, const RankTwoTensor & plastic_strain_old, RankTwoTensor & plastic_strain, const RankFourTensor & E_ijkl, const RankTwoTensor & strain_increment, std::vector<Real> & yf, unsigned int & iterations);
+  virtual bool plasticStep(const RankTwoTensor & stress_old, RankTwoTensor & stress, const std::vector<Real> & intnl_old, std::vector<Real> & intnl, const RankTwoTensor & plastic_strain_old, RankTwoTensor & plastic_strain, const RankFourTensor & E_ijkl, const RankTwoTensor & strain_increment, std::vector<Real> & yf, unsigned int & iterations, std::vector<Real> & cumulative_pm, unsigned int & return_path);
 
 
  private:
@@ -171,9 +171,23 @@ protected:
   /// Dimensionality of rank-four tensor
   static const unsigned int N = 3;
 
+  /// Number of entries in each (ij) or (kl) index pair, N^2
+  static const unsigned int N2 = N * N;
+
+  /// Total number of entries, N^4
+  static const unsigned int N4 = N2 * N2;
+
   /// The values of the rank-four tensor
   Real _vals[N][N][N][N];
 
+  /**
+   * Contiguous view of _vals, with C_ijkl at index ((i*N + j)*N + k)*N + l.
+   * Used so that entry-wise operations are single flat loops that the
+   * compiler can vectorize, and products can be written as 9x9 matrix operations.
+   */
+  Real * data() { return &_vals[0][0][0][0]; }
+  const Real * data() const { return &_vals[0][0][0][0]; }
+
   /**
    * Inverts the dense matrix A using LAPACK routines
    * @param A upon input this is a row vector representing an n-by-n matrix.  Upon output it is the inverse (as a row-vector)
@@ -5,6 +5,7 @@
 #include "PermutationTensor.h"
 
 #include "RankFourTensor.h"
+#include "SinglePrecisionTraits.h"
 
 // Any requisite includes here
 #include "libmesh/libmesh.h"
@@ -145,6 +146,9 @@ public:
   /// returns _vals_ij * a_ij (sum on i, j)
   Real doubleContraction(const RankTwoTensor & a) const;
 
+  /// returns C_ijkl = _vals_ij * a_kl
+  RankFourTensor outerProduct(const RankTwoTensor & a) const;
+
 
 
   /// returns A_ij - de_ij*tr(A)/3, where A are the _vals
@@ -302,4 +306,15 @@ private:
 
 inline RankTwoTensor operator*(Real a, const RankTwoTensor & b) { return b * a; }
 
+/**
+ * Single precision storage of old RankTwoTensor properties
+ */
+template<>
+struct SinglePrecisionTraits<RankTwoTensor>
+{
+  static const unsigned int n_components = 9;
+  static Real get(const RankTwoTensor & value, unsigned int i) { return value(i / 3, i % 3); }
+  static void set(RankTwoTensor & value, unsigned int i, Real component) { value(i / 3, i % 3) = component; }
+};
+
 #endif //RANKTWOTENSOR_H
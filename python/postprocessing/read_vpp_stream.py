@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+# Reads the files written by the VectorPostprocessorStream output (<file_base>_<name>.vpp and its
+# .index file).  Only the records listed in the index are read, so the files can be read while the
+# simulation is still appending to them:
+#
+#   from read_vpp_stream import readIndex, readRecord
+#   for time_step, time, offset in readIndex('out_line_sample.vpp'):
+#     vectors = readRecord('out_line_sample.vpp', offset)[2]
+#
+# As a script it writes the vectors of one time step (default: the last one) as CSV.
+#
+import argparse, struct, sys, csv
+
+HEADER = 'MOOSEVPP'
+
+## Read the (time_step, time, offset) entries of the index, starting after the first skip entries
+def readIndex(vpp_file, skip=0):
+  entries = []
+  f = open(vpp_file + '.index')
+  lines = f.readlines()[1 + skip:]
+  f.close()
+
+  for line in lines:
+    # A line without its newline is still being written
+    if not line.endswith('\n'):
+      break
+    time_step, time, offset = line.strip().split(',')
+    entries.append((int(time_step), float(time), int(offset)))
+  return entries
+
+## Read the record at offset and return (time_step, time, {vector name : values})
+def readRecord(vpp_file, offset):
+  f = open(vpp_file, 'rb')
+  if f.read(len(HEADER)).decode('ascii') != HEADER:
+    raise Exception(vpp_file + ' is not a VectorPostprocessorStream file')
+
+  f.seek(offset)
+  time_step, time, n_vectors = struct.unpack('=idI', f.read(16))
+
+  vectors = {}
+  for i in range(n_vectors):
+    name_length = struct.unpack('=I', f.read(4))[0]
+    name = f.read(name_length + 1)[:-1].decode('utf-8')
+    n_values = struct.unpack('=I', f.read(4))[0]
+    vectors[name] = list(struct.unpack('=%dd' % n_values, f.read(8 * n_values)))
+  f.close()
+
+  return time_step, time, vectors
+
+def main():
+  parser = argparse.ArgumentParser(description='Write the vectors of one time step of a VectorPostprocessorStream file as CSV')
+  parser.add_argument('vpp_file', help='The .vpp file')
+  parser.add_argument('-t', '--time-step', type=int, dest='time_step', default=None, help='The time step to write (default: the last one)')
+  parser.add_argument('-o', '--output', dest='output', default=None, help='The CSV file to write (default: standard output)')
+  args = parser.parse_args()
+
+  entries = readIndex(args.vpp_file)
+  if args.time_step is not None:
+    entries = [entry for entry in entries if entry[0] == args.time_step]
+  if not entries:
+    print('No such time step in ' + args.vpp_file)
+    return 1
+
+  vectors = readRecord(args.vpp_file, entries[-1][2])[2]
+  names = sorted(vectors.keys())
+
+  out = sys.stdout
+  if args.output:
+    out = open(args.output, 'w')
+  writer = csv.writer(out)
+  writer.writerow(names)
+  for row in range(max([len(vectors[name]) for name in names] + [0])):
+    writer.writerow([vectors[name][row] if row < len(vectors[name]) else '' for name in names])
+  if args.output:
+    out.close()
+
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef CUBICREACTION_H
+#define CUBICREACTION_H
+
+#include "Kernel.h"
+
+//Forward Declarations
+class CubicReaction;
+
+template<>
+InputParameters validParams<CubicReaction>();
+
+/**
+ * Nonlinear reaction term coef * u^3
+ */
+class CubicReaction : public Kernel
+{
+public:
+  CubicReaction(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+
+  Real _coef;
+};
+
+#endif //CUBICREACTION_H
@@ -6,6 +6,7 @@
 
 //Forward Declarations
 class StatefulTest;
+class Function;
 
 template<>
 InputParameters validParams<StatefulTest>();
@@ -26,6 +27,9 @@ protected:
   MaterialProperty<Real> & _thermal_conductivity;
   MaterialProperty<Real> & _thermal_conductivity_old;
   MaterialProperty<Real> & _thermal_conductivity_older;
+
+  /// Optional initial value, the sequence is then scaled by it at every point
+  Function * _initial_function;
 };
 
 #endif //STATEFULTEST_H
@@ -0,0 +1,65 @@
+# du/dt = -u^3 with a uniform solution takes four Newton iterations per step.
+# With lag_jacobian = 3 the Jacobian is rebuilt at the fourth one, and
+# lag_jacobian_steps = 2 lets the next step start with it, so every step after
+# the first reuses three Jacobians. The direct solver takes one linear
+# iteration, which must not trigger lag_jacobian_max_linear_its.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./reaction]
+    type = CubicReaction
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./num_nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./num_jacobians_reused]
+    type = NumJacobiansReused
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = 'implicit-euler'
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  line_search = 'none'
+
+  nl_rel_tol = 1e-8
+  num_steps = 5
+  dt = 0.1
+
+  lag_jacobian = 3
+  lag_jacobian_steps = 2
+  lag_jacobian_max_linear_its = 2
+[]
+
+[Outputs]
+  file_base = out_jacobian_lagging
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
@@ -0,0 +1,81 @@
+# du/dt = -u^3 + v, dv/dt = -v^3 with uniform solutions. NEWTON with a direct
+# solver takes one linear iteration per Newton iteration; MATRIX_FREE applies
+# the same exact Jacobian, so both solve types must report the same counts.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 1
+    [../]
+  [../]
+  [./v]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 2
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ie_u]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./reaction_u]
+    type = CubicReaction
+    variable = u
+  [../]
+  [./source_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+  [./ie_v]
+    type = TimeDerivative
+    variable = v
+  [../]
+  [./reaction_v]
+    type = CubicReaction
+    variable = v
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Postprocessors]
+  [./num_nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./num_linear_its]
+    type = NumLinearIterations
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = 'implicit-euler'
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  line_search = 'none'
+
+  nl_rel_tol = 1e-8
+  num_steps = 5
+  dt = 0.1
+[]
+
+[Outputs]
+  file_base = out_matrix_free_coupled
+  csv = true
+[]
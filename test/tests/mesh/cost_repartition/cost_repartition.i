@@ -0,0 +1,113 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./proc_id]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./k]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = MatDiffusion
+    variable = u
+    prop_name = thermal_conductivity
+    prop_state = old
+  [../]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./proc_id]
+    type = ProcessorIDAux
+    variable = proc_id
+  [../]
+  [./k]
+    type = MaterialRealAux
+    variable = k
+    property = thermal_conductivity
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  # Computes its property from the old and older values (2, 3, 5, 8, ...), so
+  # any state lost while migrating elements shows up in average_k
+  [./stateful]
+    type = StatefulTest
+    block = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./average_k]
+    type = ElementAverageValue
+    variable = k
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.1
+
+  # Rebalance with the measured cost of every element
+  repartition_interval = 2
+[]
+
+[Adaptivity]
+  [./Markers]
+    [./box]
+      type = BoxMarker
+      bottom_left = '0 0 0'
+      top_right = '0.3 0.3 0'
+      inside = refine
+      outside = do_nothing
+    [../]
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
@@ -0,0 +1,129 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./proc_id]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./k]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = MatDiffusion
+    variable = u
+    prop_name = thermal_conductivity
+    prop_state = old
+  [../]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./proc_id]
+    type = ProcessorIDAux
+    variable = proc_id
+  [../]
+  [./k]
+    type = MaterialRealAux
+    variable = k
+    property = thermal_conductivity
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Functions]
+  # Constant on every element of the initial mesh, so projecting onto refined
+  # children does not change it
+  [./cell]
+    type = ParsedFunction
+    value = 'floor(10*x)+10*floor(10*y)'
+  [../]
+  [./exact_k]
+    type = ParsedFunction
+    value = '(floor(10*x)+10*floor(10*y))*if(t<0.15,2,if(t<0.25,3,if(t<0.35,5,8)))'
+  [../]
+[]
+
+[Materials]
+  # Computes its property from the old and older values (2, 3, 5, 8, ... times
+  # the cell function), so any state lost or mixed up between elements while
+  # migrating shows up in k_error
+  [./stateful]
+    type = StatefulTest
+    block = 0
+    initial_function = cell
+  [../]
+[]
+
+[Postprocessors]
+  [./average_k]
+    type = ElementAverageValue
+    variable = k
+  [../]
+  [./k_error]
+    type = ElementL2Error
+    variable = k
+    function = exact_k
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.1
+
+  # Rebalance with the measured cost of every element after refining
+  repartition_after_adaptivity = true
+[]
+
+[Adaptivity]
+  marker = box
+  [./Markers]
+    [./box]
+      type = BoxMarker
+      bottom_left = '0 0 0'
+      top_right = '0.3 0.3 0'
+      inside = refine
+      outside = do_nothing
+    [../]
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
@@ -0,0 +1,61 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
+
+# All three sub-apps read the same exodus file. On one processor the second and
+# third copy the mesh read by the first one, including the block and sideset names.
+[MultiApps]
+  [./sub]
+    type = FullSolveMultiApp
+    app_type = MooseTestApp
+    execute_on = initial
+    positions = '0 0 0
+                 1 0 0
+                 2 0 0'
+    input_files = sub.i
+  [../]
+[]
@@ -0,0 +1,112 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.1
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./force_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./average_v]
+    type = ElementAverageValue
+    variable = v
+  [../]
+  [./picard_its]
+    type = NumPicardIterations
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 20
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  nl_abs_tol = 1e-12
+  picard_max_its = 10
+  picard_rel_tol = 1e-7
+[]
+
+[Outputs]
+  file_base = picard_relaxation_none
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0'
+    input_files = picard_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./v_from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = v
+  [../]
+  [./u_to_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    execute_on = timestep
+    multi_app = sub
+    source_variable = u
+    variable = u
+  [../]
+[]
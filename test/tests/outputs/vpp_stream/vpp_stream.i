@@ -0,0 +1,69 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./line_sample]
+    type = LineValueSampler
+    variable = u
+    start_point = '0 0.5 0'
+    end_point = '1 0.5 0'
+    num_points = 3
+    sort_by = id
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  [./vpp]
+    type = VectorPostprocessorStream
+    file_base = vpp_stream_out
+  [../]
+  [./checkpoint]
+    type = Checkpoint
+    file_base = vpp_stream
+  [../]
+[]
@@ -0,0 +1,118 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+# NEWTON with a direct solver needs a single Jacobian, and every object below
+# runs once per element at the end of the step, so the *_calls columns are
+# exact.  The timing columns only go to the console.
+[Problem]
+  object_timing = true
+  use_legacy_uo_initialization = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./grad_u_x]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./grad_u_x]
+    type = VariableGradientComponent
+    variable = grad_u_x
+    gradient_variable = u
+    component = x
+    execute_on = timestep
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./constant]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = diffusivity
+    prop_values = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./diff_residual_time]
+    type = ObjectTiming
+    object = diff
+    method = residual
+    outputs = console
+  [../]
+  [./diff_jacobian_calls]
+    type = ObjectTiming
+    object = diff
+    method = jacobian
+    column = n_calls
+  [../]
+  [./material_average_time]
+    type = ObjectTiming
+    object = constant
+    method = compute
+    column = average_time
+    outputs = console
+  [../]
+  [./aux_calls]
+    type = ObjectTiming
+    object = grad_u_x
+    method = compute
+    column = n_calls
+  [../]
+  [./average_u_execute_calls]
+    type = ObjectTiming
+    object = average_u
+    method = execute
+    column = n_calls
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,113 @@
+#
+# Same problem as smp_single_test.i, but the off-diagonal blocks come from the
+# kernel coupling instead of off_diag_row/off_diag_column.  With an exact
+# Jacobian, NEWTON with LU converges in a single iteration, just like full = true.
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  nx = 10
+  ny = 10
+  elem_type = QUAD4
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  [./v]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    kernel_coupling = true
+  [../]
+[]
+
+[Kernels]
+  active = 'diff_u conv_u diff_v'
+
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./conv_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[BCs]
+  active = 'left_u top_v bottom_v'
+
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 1
+  [../]
+
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 9
+  [../]
+
+  [./bottom_v]
+    type = DirichletBC
+    variable = v
+    boundary = 0
+    value = 5
+  [../]
+
+  [./top_v]
+    type = DirichletBC
+    variable = v
+    boundary = 2
+    value = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./nl_its]
+    type = NumNonlinearIterations
+    outputs = csv
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
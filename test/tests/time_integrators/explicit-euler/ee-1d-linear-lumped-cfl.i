@@ -0,0 +1,123 @@
+# The lumped mass explicit Euler update reproduces u = t*x exactly at the nodes,
+# so l2_err stays zero while cfl_dt = 0.9 * h^2 / 2 drives the time step.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = -1
+  xmax = 1
+  nx = 200
+  elem_type = EDGE2
+[]
+
+[Functions]
+  [./ic]
+    type = ParsedFunction
+    value = 0
+  [../]
+
+  [./forcing_fn]
+    type = ParsedFunction
+    value = x
+  [../]
+
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*x
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = FunctionIC
+      function = ic
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+    lumping = true
+    implicit = true
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+    implicit = false
+  [../]
+
+  [./ffn]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+    implicit = false
+  [../]
+[]
+
+[BCs]
+  active = 'all'
+
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '0 1'
+    function = exact_fn
+    implicit = true
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = 'diffusivity'
+    prop_values = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_err]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+
+  [./cfl_dt]
+    type = CFLTimeStep
+    diffusivity = diffusivity
+    cfl = 0.9
+    execute_on = timestep
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = 'explicit-euler'
+  solve_type = 'LINEAR'
+
+  lumped_mass = true
+
+  start_time = 0.0
+  num_steps = 20
+
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = cfl_dt
+    dt = 0.00002
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+    max_rows = 10
+  [../]
+[]
@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDADJACENCYTEST_H
+#define COMPRESSEDADJACENCYTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class CompressedAdjacencyTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( CompressedAdjacencyTest );
+
+  CPPUNIT_TEST( twoPassBuild );
+  CPPUNIT_TEST( appendRows );
+  CPPUNIT_TEST( extraRows );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void twoPassBuild();
+  void appendRows();
+  void extraRows();
+};
+
+#endif // COMPRESSEDADJACENCYTEST_H
@@ -0,0 +1,59 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RANKFOURTENSORTEST_H
+#define RANKFOURTENSORTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "RankFourTensor.h"
+#include "RankTwoTensor.h"
+
+class RankFourTensorTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( RankFourTensorTest );
+
+  CPPUNIT_TEST( L2normTest );
+  CPPUNIT_TEST( arithmeticTest );
+  CPPUNIT_TEST( rankTwoProductTest );
+  CPPUNIT_TEST( rankFourProductTest );
+  CPPUNIT_TEST( rotateTest );
+  CPPUNIT_TEST( invSymmTest );
+  CPPUNIT_TEST( outerProductTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  RankFourTensorTest();
+  ~RankFourTensorTest();
+
+  void L2normTest();
+  void arithmeticTest();
+  void rankTwoProductTest();
+  void rankFourProductTest();
+  void rotateTest();
+  void invSymmTest();
+  void outerProductTest();
+
+ private:
+  RankFourTensor _iden;
+  RankFourTensor _symm;
+  RankFourTensor _general;
+  RankTwoTensor _unsymmetric;
+};
+
+#endif  // RANKFOURTENSORTEST_H